@@ -551,6 +551,13 @@ void my_predict(vw_ptr all, example_ptr ec)
   VW::LEARNER::require_singleline(all->l)->predict(*ec);
 }
 
+void my_predict_batch(vw_ptr& all, py::list& ec_list)
+{
+  // Like my_predict, test_only is left alone so the examples can still be learned from.
+  multi_ex ex_coll = unwrap_example_list(ec_list);
+  VW::LEARNER::require_singleline(all->l)->predict_batch(ex_coll.data(), ex_coll.size());
+}
+
 bool my_is_multiline(vw_ptr all) { return all->l->is_multiline(); }
 
 template <bool learn>
@@ -1387,6 +1394,8 @@ PYBIND11_MODULE(pylibvw, m)
       .def("learn", &my_learn, "given a pyvw example, learn (and predict) on that example")
       .def("json_weights", &my_json_weights, "get json string of current weights")
       .def("predict", &my_predict, "given a pyvw example, predict on that example")
+      .def("predict_batch", &my_predict_batch,
+          "given a list of single line pyvw examples, predict on all of them in one pass")
       .def("hash_space", &VW::hash_space, "given a namespace (as a string), compute the hash of that namespace")
       .def("hash_feature", &VW::hash_feature,
           "given a feature string (arg2) and a hashed namespace (arg3), hash that feature")
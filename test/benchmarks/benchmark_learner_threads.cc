@@ -0,0 +1,54 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Writes a data set shaped like rcv1: binary labels and ~75 sparse tf-idf features per example drawn from a vocabulary
+// of 47k terms, so that concurrent updates rarely touch the same weights.
+static std::string write_rcv1_like_file(size_t num_examples)
+{
+  const std::string file_name = "vw_bench_rcv1_like.txt";
+  std::ofstream data(file_name);
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> feature_dist(1, 47236);
+  std::uniform_int_distribution<int> count_dist(40, 110);
+  std::uniform_real_distribution<float> value_dist(0.01f, 0.3f);
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    data << (i % 2 == 0 ? "1" : "-1") << " |f";
+    const int num_features = count_dist(rng);
+    for (int j = 0; j < num_features; ++j) { data << ' ' << feature_dist(rng) << ':' << value_dist(rng); }
+    data << '\n';
+  }
+  return file_name;
+}
+
+static void benchmark_learner_threads(benchmark::State& state)
+{
+  constexpr size_t NUM_EXAMPLES = 20000;
+  const auto data_file = write_rcv1_like_file(NUM_EXAMPLES);
+  const std::vector<std::string> args = {
+      "--quiet", "--no_stdin", "-d", data_file, "--learner_threads", std::to_string(state.range(0))};
+
+  for (auto _ : state)
+  {
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    VW::start_parser(*vw);
+    VW::LEARNER::generic_driver(*vw);
+    VW::end_parser(*vw);
+    vw->finish();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_EXAMPLES));
+  std::remove(data_file.c_str());
+}
+
+BENCHMARK(benchmark_learner_threads)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
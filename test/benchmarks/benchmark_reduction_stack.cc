@@ -0,0 +1,54 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+// Examples with a single feature, so that the time per example is dominated by the dispatch through the stack.
+template <class... ExtraArgs>
+static void benchmark_reduction_stack_learn(benchmark::State& state, std::string label, ExtraArgs&&... extra_args)
+{
+  std::vector<std::string> args = {"--quiet", "--noconstant", extra_args...};
+  if (state.range(0) == 0) { args.push_back("--dynamic_reduction_stack"); }
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  auto* ex = VW::read_example(*vw, label + " | a");
+
+  for (auto _ : state)
+  {
+    vw->learn(*ex);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  vw->finish_example(*ex);
+}
+
+static void benchmark_reduction_stack_learn_multiline(benchmark::State& state)
+{
+  std::vector<std::string> args = {"--quiet", "--noconstant", "--cb_explore_adf", "--epsilon", "0.1"};
+  if (state.range(0) == 0) { args.push_back("--dynamic_reduction_stack"); }
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::multi_ex examples = {VW::read_example(*vw, "shared | s"), VW::read_example(*vw, "0:1:0.5 | a"),
+      VW::read_example(*vw, "| b"), VW::read_example(*vw, "| c")};
+
+  for (auto _ : state)
+  {
+    vw->learn(examples);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  vw->finish_example(examples);
+}
+
+// Arg(0) dispatches through every layer of the stack, Arg(1) uses the fused stack.
+BENCHMARK_CAPTURE(benchmark_reduction_stack_learn, gd, "1")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(benchmark_reduction_stack_learn, binary_logistic, "1", "--binary", "--link", "logistic")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(benchmark_reduction_stack_learn, oaa, "2", "--oaa", "4")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(benchmark_reduction_stack_learn, csoaa, "1:0.5 2:1", "--csoaa", "4")->Arg(0)->Arg(1);
+BENCHMARK(benchmark_reduction_stack_learn_multiline)->Arg(0)->Arg(1);
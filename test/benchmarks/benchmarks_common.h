@@ -20,6 +20,18 @@ inline std::string get_x_string_fts(int feature_size)
   return s;
 };
 
+// Feature names as long as the hashed tokens of a typical text pipeline, with full precision tf-idf style values.
+inline std::string get_x_long_string_fts(int feature_size)
+{
+  std::stringstream ss;
+  ss << "1:1:0.5 |";
+  for (size_t i = 0; i < feature_size; i++)
+  {
+    ss << " user_query_token_bigram_" << std::to_string(i) << ":0." << std::to_string(1234567 + 7919 * i);
+  }
+  return ss.str();
+};
+
 inline std::string get_x_string_fts_no_label(int feature_size, size_t action_index = 0)
 {
   std::stringstream ss;
@@ -26,12 +26,18 @@ static void bench_text(benchmark::State& state, ExtraArgs&&... extra_args)
   auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--cb", "2", "--quiet"}));
   VW::multi_ex examples;
   examples.push_back(&VW::get_unused_example(vw.get()));
+  size_t features = 0;
   for (auto _ : state)
   {
     VW::parsers::text::read_line(*vw, examples[0], es);
+    features = 0;
+    for (const auto& fs : *examples[0]) { features += fs.size(); }
     VW::empty_example(*vw, *examples[0]);
     benchmark::ClobberMemory();
   }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * example_string.size()));
+  state.counters["features_per_second"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * features), benchmark::Counter::kIsRate);
 }
 
 static void benchmark_learn_simple(benchmark::State& state, std::string example_string)
@@ -242,6 +248,7 @@ static void benchmark_multi_predict(
 
 BENCHMARK_CAPTURE(bench_text, 120_string_fts, get_x_string_fts(120));
 BENCHMARK_CAPTURE(bench_text, 120_num_fts, get_x_numerical_fts(120));
+BENCHMARK_CAPTURE(bench_text, 120_long_string_fts, get_x_long_string_fts(120));
 
 BENCHMARK_CAPTURE(benchmark_learn_simple, 8_features,
     "1 zebra|MetricFeatures:3.28 height:1.5 length:2.0 |Says black with white stripes |OtherFeatures NumberOfLegs:4.0 "
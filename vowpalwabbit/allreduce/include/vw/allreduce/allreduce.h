@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #  ifndef NOMINMAX
@@ -104,6 +105,12 @@ void addbufs(T* buf1, const T* buf2, const size_t n)
   for (size_t i = 0; i < n; i++) { f(buf1[i], buf2[i]); }
 }
 
+template <class T>
+void add_value(T& x, const T& y)
+{
+  x += y;
+}
+
 }  // namespace details
 
 class all_reduce_base
@@ -211,22 +218,34 @@ class all_reduce_sockets : public all_reduce_base
 {
 public:
   all_reduce_sockets(std::string pspan_server, const int pport, const size_t punique_id, size_t ptotal,
-      const size_t pnode, bool pquiet)
+      const size_t pnode, bool pquiet, all_reduce_algorithm palgorithm = all_reduce_algorithm::TREE)
       : all_reduce_base(ptotal, pnode, pquiet)
       , _span_server(std::move(pspan_server))
       , _port(pport)
       , _unique_id(punique_id)
+      , _algorithm(palgorithm)
   {
   }
 
-  ~all_reduce_sockets() override = default;
+  ~all_reduce_sockets() override;
 
   template <class T, void (*f)(T&, const T&)>
   void all_reduce(T* buffer, const size_t n, VW::io::logger& logger)
   {
     if (_span_server != _socks.current_master) { all_reduce_init(logger); }
-    reduce<T, f>((char*)buffer, n * sizeof(T));
-    broadcast((char*)buffer, n * sizeof(T));
+    switch (_algorithm)
+    {
+      case all_reduce_algorithm::TREE:
+        reduce<T, f>((char*)buffer, n * sizeof(T));
+        broadcast((char*)buffer, n * sizeof(T));
+        break;
+      case all_reduce_algorithm::RING:
+        ring_all_reduce<T, f>(buffer, n);
+        break;
+      case all_reduce_algorithm::RECURSIVE_HALVING:
+        recursive_halving_all_reduce<T, f>(buffer, n);
+        break;
+    }
   }
 
 private:
@@ -234,8 +253,112 @@ private:
   std::string _span_server;
   int _port;
   size_t _unique_id;  // unique id for each node in the network, id == 0 means extra io.
+  all_reduce_algorithm _algorithm;
+  std::vector<socket_t> _peers;  // direct connections by node id for ring and recursive halving, -1 if not connected
 
   void all_reduce_init(VW::io::logger& logger);
+  void connect_peers(VW::io::logger& logger);
+  // Sends send_size bytes to node send_to while receiving recv_size bytes from node recv_from.
+  void exchange(size_t send_to, const char* send_buf, size_t send_size, size_t recv_from, char* recv_buf,
+      size_t recv_size);
+
+  template <class T, void (*f)(T&, const T&)>
+  void ring_all_reduce(T* buffer, const size_t n)
+  {
+    if (total == 1) { return; }
+    const size_t next = (node + 1) % total;
+    const size_t prev = (node + total - 1) % total;
+    // Segment s is [segment(s), segment(s + 1)).
+    auto segment = [n, this](size_t s) { return n / total * s + std::min(s, n % total); };
+    std::vector<T> scratch(n / total + 1);
+
+    // Reduce-scatter: in step s the segment node - s is passed on, afterwards node holds the sum of node + 1.
+    for (size_t step = 0; step + 1 < total; step++)
+    {
+      const size_t send_segment = (node + total - step) % total;
+      const size_t recv_segment = (node + total - step - 1) % total;
+      const size_t recv_count = segment(recv_segment + 1) - segment(recv_segment);
+      exchange(next, reinterpret_cast<const char*>(buffer + segment(send_segment)),
+          (segment(send_segment + 1) - segment(send_segment)) * sizeof(T), prev,
+          reinterpret_cast<char*>(scratch.data()), recv_count * sizeof(T));
+      details::addbufs<T, f>(buffer + segment(recv_segment), scratch.data(), recv_count);
+    }
+
+    // Allgather: pass the completed segments around the ring.
+    for (size_t step = 0; step + 1 < total; step++)
+    {
+      const size_t send_segment = (node + 1 + total - step) % total;
+      const size_t recv_segment = (node + total - step) % total;
+      exchange(next, reinterpret_cast<const char*>(buffer + segment(send_segment)),
+          (segment(send_segment + 1) - segment(send_segment)) * sizeof(T), prev,
+          reinterpret_cast<char*>(buffer + segment(recv_segment)),
+          (segment(recv_segment + 1) - segment(recv_segment)) * sizeof(T));
+    }
+  }
+
+  template <class T, void (*f)(T&, const T&)>
+  void recursive_halving_all_reduce(T* buffer, const size_t n)
+  {
+    if (total == 1) { return; }
+    size_t group = 1;
+    while (group * 2 <= total) { group *= 2; }
+    const size_t no_peer = total;
+
+    // Nodes beyond the largest power of two hand their buffer to a partner in the group and get the sum back.
+    if (node >= group)
+    {
+      exchange(node - group, reinterpret_cast<const char*>(buffer), n * sizeof(T), no_peer, nullptr, 0);
+      exchange(no_peer, nullptr, 0, node - group, reinterpret_cast<char*>(buffer), n * sizeof(T));
+      return;
+    }
+
+    std::vector<T> scratch(n);
+    if (node + group < total)
+    {
+      exchange(no_peer, nullptr, 0, node + group, reinterpret_cast<char*>(scratch.data()), n * sizeof(T));
+      details::addbufs<T, f>(buffer, scratch.data(), n);
+    }
+
+    // Recursive halving: in every round the partners split their common range and each sums up one half.
+    std::vector<std::pair<size_t, size_t>> ranges;
+    size_t begin = 0;
+    size_t end = n;
+    for (size_t distance = group / 2; distance > 0; distance /= 2)
+    {
+      ranges.emplace_back(begin, end);
+      const size_t middle = begin + (end - begin) / 2;
+      const bool keep_lower = (node & distance) == 0;
+      const size_t keep_begin = keep_lower ? begin : middle;
+      const size_t keep_end = keep_lower ? middle : end;
+      const size_t give_begin = keep_lower ? middle : begin;
+      const size_t give_end = keep_lower ? end : middle;
+      exchange(node ^ distance, reinterpret_cast<const char*>(buffer + give_begin), (give_end - give_begin) * sizeof(T),
+          node ^ distance, reinterpret_cast<char*>(scratch.data()), (keep_end - keep_begin) * sizeof(T));
+      details::addbufs<T, f>(buffer + keep_begin, scratch.data(), keep_end - keep_begin);
+      begin = keep_begin;
+      end = keep_end;
+    }
+
+    // Recursive doubling: the same rounds in reverse order, exchanging the completed halves.
+    for (size_t distance = 1; distance < group; distance *= 2)
+    {
+      const auto range = ranges.back();
+      ranges.pop_back();
+      const size_t middle = range.first + (range.second - range.first) / 2;
+      const bool kept_lower = (node & distance) == 0;
+      const size_t other_begin = kept_lower ? middle : range.first;
+      const size_t other_end = kept_lower ? range.second : middle;
+      exchange(node ^ distance, reinterpret_cast<const char*>(buffer + begin), (end - begin) * sizeof(T),
+          node ^ distance, reinterpret_cast<char*>(buffer + other_begin), (other_end - other_begin) * sizeof(T));
+      begin = range.first;
+      end = range.second;
+    }
+
+    if (node + group < total)
+    {
+      exchange(node + group, reinterpret_cast<const char*>(buffer), n * sizeof(T), no_peer, nullptr, 0);
+    }
+  }
 
   template <class T>
   void pass_up(char* buffer, size_t left_read_pos, size_t right_read_pos, size_t& parent_sent_pos)
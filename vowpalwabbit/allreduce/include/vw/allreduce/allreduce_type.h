@@ -11,4 +11,17 @@ enum class all_reduce_type
   SOCKET,
   THREAD
 };
+
+// How all_reduce_sockets combines the buffers of the nodes. The spanning tree server is used to connect the nodes in
+// every case.
+enum class all_reduce_algorithm
+{
+  // Reduce up and broadcast down the binary spanning tree.
+  TREE,
+  // Reduce-scatter followed by allgather around a ring of all nodes. Every node sends and receives about twice the
+  // buffer size, independent of the number of nodes.
+  RING,
+  // Recursive halving reduce-scatter followed by recursive doubling allgather, which needs log2(total) rounds.
+  RECURSIVE_HALVING
+};
 }  // namespace VW
@@ -26,6 +26,7 @@ Alekh Agarwal and John Langford, with help Olivier Chapelle.
 #  include <io.h>
 #else
 #  include <arpa/inet.h>
+#  include <fcntl.h>
 #  include <unistd.h>
 #endif
 #include "vw/allreduce/allreduce.h"
@@ -34,6 +35,50 @@ Alekh Agarwal and John Langford, with help Olivier Chapelle.
 
 #include <sys/timeb.h>
 
+#include <algorithm>
+
+namespace
+{
+bool would_block()
+{
+#ifdef _WIN32
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+void set_non_blocking(socket_t sock)
+{
+#ifdef _WIN32
+  u_long mode = 1;
+  if (ioctlsocket(sock, FIONBIO, &mode) != 0) THROWERRNO("ioctlsocket");
+#else
+  const int flags = fcntl(sock, F_GETFL, 0);
+  if (flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1) THROWERRNO("fcntl");
+#endif
+}
+
+void recv_all(socket_t sock, char* buffer, size_t size, const char* what)
+{
+  size_t received = 0;
+  while (received < size)
+  {
+    const auto read_size = recv(sock, buffer + received, static_cast<int>(size - received), 0);
+    if (read_size <= 0) THROW("Read " << what << " failed");
+    received += static_cast<size_t>(read_size);
+  }
+}
+}  // namespace
+
+VW::all_reduce_sockets::~all_reduce_sockets()
+{
+  for (auto sock : _peers)
+  {
+    if (sock != static_cast<socket_t>(-1)) { CLOSESOCK(sock); }
+  }
+}
+
 // port is already in network order
 socket_t VW::all_reduce_sockets::sock_connect(const uint32_t ip, const int port, VW::io::logger& logger)
 {
@@ -250,6 +295,152 @@ void VW::all_reduce_sockets::all_reduce_init(VW::io::logger& logger)
   }
 
   if (kid_count > 0) { CLOSESOCK(sock); }
+
+  if (_algorithm != all_reduce_algorithm::TREE) { connect_peers(logger); }
+}
+
+void VW::all_reduce_sockets::connect_peers(VW::io::logger& logger)
+{
+  for (auto sock : _peers)
+  {
+    if (sock != static_cast<socket_t>(-1)) { CLOSESOCK(sock); }
+  }
+  _peers.assign(total, static_cast<socket_t>(-1));
+  if (total == 1) { return; }
+
+  // Nodes this one exchanges data with. The relation is symmetric and the node with the higher id connects.
+  std::vector<size_t> peers;
+  if (_algorithm == all_reduce_algorithm::RING) { peers = {(node + 1) % total, (node + total - 1) % total}; }
+  else
+  {
+    size_t group = 1;
+    while (group * 2 <= total) { group *= 2; }
+    if (node >= group) { peers.push_back(node - group); }
+    else
+    {
+      for (size_t distance = 1; distance < group; distance *= 2) { peers.push_back(node ^ distance); }
+      if (node + group < total) { peers.push_back(node + group); }
+    }
+  }
+  std::sort(peers.begin(), peers.end());
+  peers.erase(std::unique(peers.begin(), peers.end()), peers.end());
+
+  socket_t listener = getsock(logger);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = 0;
+  if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) THROWERRNO("bind");
+  if (listen(listener, static_cast<int>(peers.size())) < 0) THROWERRNO("listen");
+  socklen_t address_size = sizeof(address);
+  if (getsockname(listener, reinterpret_cast<sockaddr*>(&address), &address_size) < 0) THROWERRNO("getsockname");
+  const uint16_t listen_port = address.sin_port;
+
+  // Our address as seen by the other nodes is the local end of the connections of the spanning tree.
+  sockaddr_in local;
+  address_size = sizeof(local);
+  const socket_t tree_sock = _socks.parent != static_cast<socket_t>(-1) ? _socks.parent : _socks.children[0];
+  if (getsockname(tree_sock, reinterpret_cast<sockaddr*>(&local), &address_size) < 0) THROWERRNO("getsockname");
+
+  // Every node fills in its own address, so summing over the spanning tree hands all addresses to all nodes. Both
+  // parts stay in network byte order.
+  std::vector<uint64_t> addresses(total, 0);
+  addresses[node] = (static_cast<uint64_t>(local.sin_addr.s_addr) << 16) | listen_port;
+  reduce<uint64_t, details::add_value<uint64_t>>(reinterpret_cast<char*>(addresses.data()), total * sizeof(uint64_t));
+  broadcast(reinterpret_cast<char*>(addresses.data()), total * sizeof(uint64_t));
+
+  size_t expected_connections = 0;
+  for (auto peer : peers)
+  {
+    if (peer > node)
+    {
+      expected_connections++;
+      continue;
+    }
+    const auto peer_ip = static_cast<uint32_t>(addresses[peer] >> 16);
+    const auto peer_port = static_cast<uint16_t>(addresses[peer] & 0xffff);
+    socket_t sock = sock_connect(peer_ip, peer_port, logger);
+    const auto id = static_cast<uint64_t>(node);
+    if (send(sock, reinterpret_cast<const char*>(&id), sizeof(id), 0) < static_cast<int>(sizeof(id)))
+    {
+      THROW("Write node=" << node << " to node " << peer << " failed");
+    }
+    _peers[peer] = sock;
+  }
+
+  for (size_t i = 0; i < expected_connections; i++)
+  {
+    socket_t sock = accept(listener, nullptr, nullptr);
+#ifdef _WIN32
+    if (sock == INVALID_SOCKET)
+#else
+    if (sock < 0)
+#endif
+      THROWERRNO("accept");
+    uint64_t id = 0;
+    recv_all(sock, reinterpret_cast<char*>(&id), sizeof(id), "node id of peer");
+    if (id >= total || id <= node || _peers[id] != static_cast<socket_t>(-1))
+    {
+      THROW("Unexpected connection from node " << id << " to node " << node);
+    }
+    _peers[id] = sock;
+  }
+  CLOSESOCK(listener);
+
+  int on = 1;
+  for (auto sock : _peers)
+  {
+    if (sock == static_cast<socket_t>(-1)) { continue; }
+    if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&on), sizeof(on)) < 0)
+    {
+      logger.err_error("setsockopt TCP_NODELAY: {}", VW::io::strerror_to_string(errno));
+    }
+    // Both directions are served by one select loop, a blocking send could wait for a peer that is sending too.
+    set_non_blocking(sock);
+  }
+}
+
+void VW::all_reduce_sockets::exchange(
+    size_t send_to, const char* send_buf, size_t send_size, size_t recv_from, char* recv_buf, size_t recv_size)
+{
+  size_t sent = 0;
+  size_t received = 0;
+  while (sent < send_size || received < recv_size)
+  {
+    fd_set read_fds;
+    fd_set write_fds;
+    FD_ZERO(&read_fds);
+    FD_ZERO(&write_fds);
+    socket_t max_fd = 0;
+    if (sent < send_size)
+    {
+      FD_SET(_peers[send_to], &write_fds);
+      max_fd = std::max(max_fd, _peers[send_to]);
+    }
+    if (received < recv_size)
+    {
+      FD_SET(_peers[recv_from], &read_fds);
+      max_fd = std::max(max_fd, _peers[recv_from]);
+    }
+    if (select(static_cast<int>(max_fd + 1), &read_fds, &write_fds, nullptr, nullptr) == -1) THROWERRNO("select");
+
+    if (sent < send_size && FD_ISSET(_peers[send_to], &write_fds))
+    {
+      const size_t count = std::min(details::AR_BUF_SIZE, send_size - sent);
+      const auto write_size = send(_peers[send_to], send_buf + sent, static_cast<int>(count), 0);
+      if (write_size >= 0) { sent += static_cast<size_t>(write_size); }
+      else if (!would_block()) THROWERRNO("send to node " << send_to);
+    }
+    if (received < recv_size && FD_ISSET(_peers[recv_from], &read_fds))
+    {
+      const size_t count = std::min(details::AR_BUF_SIZE, recv_size - received);
+      const auto read_size = recv(_peers[recv_from], recv_buf + received, static_cast<int>(count), 0);
+      if (read_size > 0) { received += static_cast<size_t>(read_size); }
+      else if (read_size == 0) { THROW("Node " << recv_from << " closed the connection"); }
+      else if (!would_block()) THROWERRNO("recv from node " << recv_from);
+    }
+  }
 }
 
 void VW::all_reduce_sockets::pass_down(char* buffer, const size_t parent_read_pos, size_t& children_sent_pos)
@@ -0,0 +1,91 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/allreduce/allreduce.h"
+#include "vw/io/logger.h"
+#include "vw/spanning_tree/spanning_tree.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Runs one all_reduce on total nodes connected over loopback, each on its own thread, and returns their buffers.
+std::vector<std::vector<float>> run_nodes(VW::all_reduce_algorithm algorithm, size_t total, size_t size)
+{
+  VW::spanning_tree server(0, true);
+  server.start();
+
+  std::vector<std::vector<float>> buffers(total);
+  std::vector<std::exception_ptr> errors(total);
+  std::vector<std::thread> nodes;
+  for (size_t node = 0; node < total; ++node)
+  {
+    nodes.emplace_back(
+        [&, node]
+        {
+          try
+          {
+            auto logger = VW::io::create_null_logger();
+            VW::all_reduce_sockets all_reduce("localhost", server.bound_port(), 1, total, node, true, algorithm);
+            auto& buffer = buffers[node];
+            for (size_t i = 0; i < size; ++i) { buffer.push_back(static_cast<float>((node + 1) * (i % 7 + 1))); }
+            all_reduce.all_reduce<float, VW::details::add_value<float>>(buffer.data(), buffer.size(), logger);
+            // A second call reuses the connections.
+            all_reduce.all_reduce<float, VW::details::add_value<float>>(buffer.data(), buffer.size(), logger);
+          }
+          catch (...)
+          {
+            errors[node] = std::current_exception();
+          }
+        });
+  }
+  // The server is stopped by its destructor.
+  for (auto& thread : nodes) { thread.join(); }
+  for (const auto& error : errors)
+  {
+    if (error) { std::rethrow_exception(error); }
+  }
+  return buffers;
+}
+
+void expect_sums(VW::all_reduce_algorithm algorithm, size_t total, size_t size)
+{
+  SCOPED_TRACE("total=" + std::to_string(total) + " size=" + std::to_string(size));
+  const auto buffers = run_nodes(algorithm, total, size);
+  // After two calls every entry is total times the sum over the nodes.
+  const auto node_sum = static_cast<float>(total * (total + 1) / 2);
+  for (const auto& buffer : buffers)
+  {
+    ASSERT_EQ(buffer.size(), size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      EXPECT_FLOAT_EQ(buffer[i], static_cast<float>(total) * node_sum * static_cast<float>(i % 7 + 1));
+    }
+  }
+}
+}  // namespace
+
+TEST(AllReduceSockets, TreeSums)
+{
+  for (size_t total : {1, 2, 3}) { expect_sums(VW::all_reduce_algorithm::TREE, total, 1000); }
+}
+
+TEST(AllReduceSockets, RingSums)
+{
+  for (size_t total : {1, 2, 3, 5}) { expect_sums(VW::all_reduce_algorithm::RING, total, 100003); }
+  // Fewer elements than nodes leaves some segments empty.
+  expect_sums(VW::all_reduce_algorithm::RING, 5, 3);
+}
+
+TEST(AllReduceSockets, RecursiveHalvingSums)
+{
+  for (size_t total : {1, 2, 4, 5, 7}) { expect_sums(VW::all_reduce_algorithm::RECURSIVE_HALVING, total, 100003); }
+  expect_sums(VW::all_reduce_algorithm::RECURSIVE_HALVING, 4, 3);
+}
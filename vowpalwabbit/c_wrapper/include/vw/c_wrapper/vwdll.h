@@ -116,6 +116,8 @@ extern "C"
 
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Learn(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Predict(VW_HANDLE handle, VW_EXAMPLE e);
+  // Predicts count examples at once, read each prediction with VW_GetPrediction.
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatch(VW_HANDLE handle, VW_EXAMPLE* examples, size_t count);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_PredictCostSensitive(VW_HANDLE handle, VW_EXAMPLE e);
   // deprecated. Please use either VW_ReadExample for parsing, or VW_ImportExample for example construction
   VW_DLL_PUBLIC void VW_CALLING_CONV VW_AddLabel(VW_EXAMPLE e, float label, float weight, float base);
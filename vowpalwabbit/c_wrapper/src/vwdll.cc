@@ -346,6 +346,13 @@ extern "C"
     return VW::get_prediction(ex);
   }
 
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatch(VW_HANDLE handle, VW_EXAMPLE* examples, size_t count)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    VW::LEARNER::require_singleline(pointer->l)
+        ->predict_batch(reinterpret_cast<VW::example* const*>(examples), count);
+  }
+
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_PredictCostSensitive(VW_HANDLE handle, VW_EXAMPLE e)
   {
     auto* pointer = static_cast<VW::workspace*>(handle);
@@ -5,6 +5,7 @@
 #include "vw/common/vw_exception.h"
 #include "vw/config/options.h"
 #include "vw/config/options_cli.h"
+#include "vw/core/event_daemon.h"
 #include "vw/core/global_data.h"
 #include "vw/core/learner.h"
 #include "vw/core/memory.h"
@@ -96,7 +97,16 @@ int main(int argc, char* argv[])
       return 0;
     }
 
+#ifdef VW_FEAT_NETWORKING_ENABLED
+    if (all.runtime_config.daemon_event_loop)
+    {
+      if (alls.size() != 1) THROW("--daemon_event_loop doesn't make sense with multiple learners");
+      VW::details::run_event_daemon(all);
+    }
+    else if (should_use_onethread)
+#else
     if (should_use_onethread)
+#endif
     {
       if (alls.size() == 1) { VW::LEARNER::generic_driver_onethread(all); }
       else
@@ -9,6 +9,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
 
 namespace VW
 {
@@ -38,5 +41,33 @@ void do_weighting(size_t normalized_idx, uint64_t length, const float* local_wei
   }
 }
 
+// Averages dense weights across nodes on a background thread while learning continues. start() takes a snapshot of the
+// weights and returns right away. finish() waits for the average of the snapshots and moves the weights by the
+// difference between the average and the snapshot, which keeps the updates made in the meantime. No other all_reduce
+// may run between the two calls.
+class async_accumulator
+{
+public:
+  async_accumulator() = default;
+  async_accumulator(const async_accumulator&) = delete;
+  async_accumulator& operator=(const async_accumulator&) = delete;
+  ~async_accumulator();
+
+  void start(VW::workspace& all, parameters& weights);
+  void finish(parameters& weights);
+  bool pending() const { return _thread.joinable(); }
+
+private:
+  void average(VW::workspace& all, uint64_t length);
+
+  std::thread _thread;
+  std::vector<float> _snapshot;
+  std::vector<float> _average;
+  bool _adaptive = false;
+  uint32_t _stride_shift = 0;
+  size_t _normalized_idx = 0;
+  std::exception_ptr _error;
+};
+
 }  // namespace details
 }  // namespace VW
\ No newline at end of file
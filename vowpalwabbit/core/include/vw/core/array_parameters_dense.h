@@ -153,6 +153,10 @@ public:
 
   void set_zero(size_t offset);
 
+  /// Replaces the memory backing the weights, for example with a memory mapped model. memory must hold raw_length()
+  /// weights.
+  void set_memory(std::shared_ptr<VW::weight> memory) { _begin = std::move(memory); }
+
   uint64_t mask() const { return _weight_mask; }
 
   uint64_t raw_length() const { return _weight_mask + 1; }
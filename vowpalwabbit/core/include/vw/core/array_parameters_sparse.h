@@ -9,9 +9,12 @@
 #include "vw/core/constant.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <type_traits>
+#include <vector>
 
 namespace VW
 {
@@ -19,8 +22,55 @@ namespace VW
 class sparse_parameters;
 namespace details
 {
+class sparse_entry
+{
+public:
+  uint64_t index = 0;
+  VW::weight* block = nullptr;  // nullptr marks an empty slot
+};
+
+// Large zeroed slabs which the blocks of one model are carved out of. Slabs never move, so references to weights stay
+// valid while the table grows.
+class sparse_slabs
+{
+public:
+  // Slabs can be shared with other shards through shallow_copy, new blocks are only ever taken from a slab allocated
+  // since.
+  std::vector<std::shared_ptr<VW::weight>> slabs;
+  size_t used = 0;
+  size_t capacity = 0;
+
+  VW::weight* allocate(size_t stride);
+};
 
-using weight_map = std::unordered_map<uint64_t, std::shared_ptr<VW::weight>>;
+// Open addressing hash table, with linear probing, from a weight index to its block of stride weights.
+class sparse_shard
+{
+public:
+  std::vector<sparse_entry> table;
+  size_t size = 0;
+  // The slabs of each model, see sparse_parameters::set_model_width().
+  std::vector<sparse_slabs> models;
+  // Only taken when the shards are shared by several threads, see sparse_parameters::enable_concurrent_inserts().
+  std::mutex mutex;
+
+  VW::weight* find(uint64_t index, uint64_t hash) const;
+  // Returns the block of index, or allocates a zeroed one from the slabs of model and sets inserted if it has none.
+  VW::weight* find_or_insert(uint64_t index, uint64_t hash, size_t stride, uint64_t model, bool& inserted);
+  void add(uint64_t index, uint64_t hash, VW::weight* block);
+  // Removes the entries whose index matches, their blocks stay where they are.
+  void remove_if(const std::function<bool(uint64_t)>& matches);
+  sparse_slabs& slabs_of(uint64_t model);
+
+private:
+  void grow();
+};
+
+inline uint64_t sparse_hash(uint64_t index)
+{
+  const uint64_t hash = index * 0x9E3779B97F4A7C15ULL;
+  return hash ^ (hash >> 32);
+}
 
 template <typename T>
 class sparse_iterator
@@ -31,29 +81,50 @@ public:
   using difference_type = ptrdiff_t;
   using pointer = T*;
   using reference = T&;
+  using shard_type = typename std::conditional<std::is_const<T>::value, const sparse_shard, sparse_shard>::type;
 
-  sparse_iterator(weight_map::iterator iter) : _iter(iter) {}
+  sparse_iterator(shard_type* shards, size_t num_shards, size_t shard)
+      : _shards(shards), _num_shards(num_shards), _shard(shard)
+  {
+    skip_empty();
+  }
 
   sparse_iterator& operator=(const sparse_iterator& other) = default;
   sparse_iterator(const sparse_iterator& other) = default;
   sparse_iterator& operator=(sparse_iterator&& other) noexcept = default;
   sparse_iterator(sparse_iterator&& other) noexcept = default;
 
-  uint64_t index() { return _iter->first; }
+  uint64_t index() { return _shards[_shard].table[_slot].index; }
 
-  T& operator*() { return *(_iter->second); }
+  T& operator*() { return *(_shards[_shard].table[_slot].block); }
 
   sparse_iterator& operator++()
   {
-    _iter++;
+    _slot++;
+    skip_empty();
     return *this;
   }
 
-  bool operator==(const sparse_iterator& rhs) const { return _iter == rhs._iter; }
-  bool operator!=(const sparse_iterator& rhs) const { return _iter != rhs._iter; }
+  bool operator==(const sparse_iterator& rhs) const { return _shard == rhs._shard && _slot == rhs._slot; }
+  bool operator!=(const sparse_iterator& rhs) const { return !(*this == rhs); }
 
 private:
-  weight_map::iterator _iter;
+  void skip_empty()
+  {
+    while (_shard < _num_shards)
+    {
+      const auto& table = _shards[_shard].table;
+      while (_slot < table.size() && table[_slot].block == nullptr) { _slot++; }
+      if (_slot < table.size()) { return; }
+      _shard++;
+      _slot = 0;
+    }
+  }
+
+  shard_type* _shards;
+  size_t _num_shards;
+  size_t _shard;
+  size_t _slot = 0;
 };
 }  // namespace details
 class sparse_parameters
@@ -74,26 +145,53 @@ public:
   VW::weight* first() { THROW_OR_RETURN("Allreduce currently not supported in sparse", nullptr); }
 
   // iterator with stride
-  iterator begin() { return iterator(_map.begin()); }
-  iterator end() { return iterator(_map.end()); }
+  iterator begin() { return iterator(_shards->data(), _shards->size(), 0); }
+  iterator end() { return iterator(_shards->data(), _shards->size(), _shards->size()); }
 
   // const iterator
-  const_iterator cbegin() const { return const_iterator(_map.begin()); }
-  const_iterator cend() const { return const_iterator(_map.end()); }
+  const_iterator cbegin() const { return const_iterator(_shards->data(), _shards->size(), 0); }
+  const_iterator cend() const { return const_iterator(_shards->data(), _shards->size(), _shards->size()); }
 
-  // operator[] will find weight in _map and return and insert a default value if not found. Does alter _map.
+  // operator[] will find the weight and return it, inserting a default value if not found.
   inline VW::weight& operator[](size_t i) { return *(get_or_default_and_get(i)); }
-  inline const VW::weight& operator[](size_t i) const { return *(get_or_default_and_get(i)); }
+  // The const versions never insert. A weight which is not found is returned as a default value in a per thread
+  // scratch block, which is only valid until the next such lookup.
+  inline const VW::weight& operator[](size_t i) const { return *(get_const_impl(i)); }
 
-  // get() will find weight in _map and return a default value if not found. Does not alter _map.
+  // get() will find the weight and return a default value if not found. Only inserts when a default function is set.
   inline VW::weight& get(size_t i) { return *(get_impl(i)); };
-  inline const VW::weight& get(size_t i) const { return *(get_impl(i)); };
+  inline const VW::weight& get(size_t i) const { return *(get_const_impl(i)); };
 
   inline VW::weight& strided_index(size_t index) { return operator[](index << _stride_shift); }
   inline const VW::weight& strided_index(size_t index) const { return operator[](index << _stride_shift); }
 
+  // Level-1 shallow copy: the weights which exist in input are shared, weights inserted later are not. If input has
+  // concurrent inserts enabled the whole table is shared instead.
   void shallow_copy(const sparse_parameters& input);
 
+  // Splits the table into num_shards independently locked shards, so that several threads can look up and insert
+  // weights at once. The table is shared with every instance that is later shallow copied from this one. The default
+  // function is then called from several threads and must be safe to do so. num_shards must be a power of 2.
+  void enable_concurrent_inserts(size_t num_shards);
+  bool concurrent_inserts() const { return _concurrent; }
+
+  // Gives each of the width models which are interleaved in the weights (see multi_model_utils.h) slabs of their own,
+  // so that the weights of a model are not interleaved in memory with those of the others and can be copied or freed
+  // as a whole. width must be a power of 2 and can only change while there are no weights.
+  void set_model_width(uint64_t width);
+  uint64_t model_width() const { return _model_mask + 1; }
+
+  // The model operations below are not safe to call while other threads use the weights.
+  // Replaces the weights of model to with a copy of the weights of model from.
+  void copy_model(uint64_t from, uint64_t to);
+  // Exchanges the weights of models a and b.
+  void swap_models(uint64_t a, uint64_t b);
+  // Removes all the weights of model and frees their memory once no shallow copy refers to it either.
+  void release_model(uint64_t model);
+
+  // Number of indices which have weights.
+  size_t size() const;
+
   template <typename Lambda>
   void set_default(Lambda&& default_func)
   {
@@ -114,16 +212,31 @@ public:
 #endif
 
 private:
-  // This must be mutable because the const operator[] must be able to intialize default weights to return.
-  mutable details::weight_map _map;
+  std::shared_ptr<std::vector<details::sparse_shard>> _shards;
+  uint32_t _shard_bits = 0;
+  bool _concurrent = false;
   uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
+  uint64_t _model_mask = 0;
   std::function<void(VW::weight*, uint64_t)> _default_func;
 
-  // It is marked const so it can be used from both const and non const operator[]
-  // The map itself is mutable to facilitate this
-  VW::weight* get_or_default_and_get(size_t i) const;
-  VW::weight* get_impl(size_t i) const;
+  uint64_t model_of(uint64_t index) const { return (index >> _stride_shift) & _model_mask; }
+  uint64_t with_model(uint64_t index, uint64_t model) const
+  {
+    return (index & ~(_model_mask << _stride_shift)) | (model << _stride_shift);
+  }
+  // Returns false if model is out of range, which throws unless exceptions are disabled.
+  bool check_model(uint64_t model) const;
+
+  details::sparse_shard& shard_of(uint64_t hash) const
+  {
+    return (*_shards)[_shard_bits == 0 ? 0 : hash >> (64 - _shard_bits)];
+  }
+
+  VW::weight* get_or_default_and_get(size_t i);
+  VW::weight* get_impl(size_t i);
+  const VW::weight* get_const_impl(size_t i) const;
+  VW::weight* default_block(uint64_t index) const;
 };
 }  // namespace VW
 using sparse_parameters VW_DEPRECATED("sparse_parameters moved into VW namespace") = VW::sparse_parameters;
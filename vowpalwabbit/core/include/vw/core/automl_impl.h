@@ -4,8 +4,10 @@
 #pragma once
 
 #include "vw/common/random.h"
+#include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
 #include "vw/core/learner.h"
+#include "vw/core/thread_pool.h"
 
 #include <fstream>
 #include <functional>
@@ -15,6 +17,9 @@ namespace VW
 {
 namespace reductions
 {
+class cb_adf;
+class gd;
+
 namespace automl
 {
 namespace
@@ -208,7 +213,7 @@ public:
   const uint64_t default_lease;
   const uint64_t max_live_configs;
   uint64_t priority_challengers;
-  dense_parameters& weights;
+  VW::parameters& weights;
   double automl_significance_level;
   VW::io::logger* logger;
   uint32_t& feature_width;
@@ -230,7 +235,7 @@ public:
 
   interaction_config_manager(uint64_t global_lease, uint64_t max_live_configs,
       std::shared_ptr<VW::rand_state> rand_state, uint64_t priority_challengers, const std::string& interaction_type,
-      const std::string& oracle_type, dense_parameters& weights, priority_func calc_priority,
+      const std::string& oracle_type, VW::parameters& weights, priority_func calc_priority,
       double automl_significance_level, VW::io::logger* logger, uint32_t& feature_width, bool ccb_on,
       config_type conf_type, std::string trace_prefix, bool reward_as_cost, double tol_x, bool is_brentq);
 
@@ -266,6 +271,14 @@ enum class automl_state
   Experimenting
 };
 
+// The learners with state per model that automl::concurrent_learn keeps in sync, null if not in the stack.
+class per_model_learners
+{
+public:
+  VW::reductions::gd* gd = nullptr;
+  VW::reductions::cb_adf* cb_adf = nullptr;
+};
+
 template <typename CMType>
 class automl
 {
@@ -278,6 +291,20 @@ public:
   const bool should_save_predict_only_model;
   std::unique_ptr<std::ofstream> log_file;
 
+  // With --automl_threads the challengers learn on the thread pool while the champ learns on the calling thread. Each
+  // challenger learns on its own copy of the examples through the base learner of its own replica workspace, which
+  // shares the weights of all. The replicas are created on the first learn.
+  VW::workspace* all = nullptr;
+  std::unique_ptr<VW::thread_pool> threads;
+  std::vector<std::unique_ptr<VW::workspace>> replicas;
+  std::vector<VW::LEARNER::learner*> replica_bases;
+  // The state that learners below automl keep per model is only learned by the replica for the slot of a challenger, so
+  // that slot of it is copied from all before the replica learns and back afterwards.
+  per_model_learners all_learners;
+  std::vector<per_model_learners> replica_learners;
+  std::vector<std::vector<std::unique_ptr<VW::example>>> slot_examples;
+  std::vector<multi_ex> slot_exs;
+
   automl(std::unique_ptr<CMType> cm, VW::io::logger* logger, bool predict_only_model, std::string trace_prefix)
       : cm(std::move(cm)), logger(logger), should_save_predict_only_model(predict_only_model)
   {
@@ -292,6 +319,9 @@ public:
   // This fn gets called before learning any example
   void one_step(VW::LEARNER::learner& base, multi_ex& ec, VW::cb_class& logged, uint64_t labelled_action);
   void offset_learn(VW::LEARNER::learner& base, multi_ex& ec, VW::cb_class& logged, uint64_t labelled_action);
+
+private:
+  void concurrent_learn(VW::LEARNER::learner& base, multi_ex& ec);
 };
 }  // namespace automl
 
@@ -0,0 +1,48 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace VW
+{
+namespace details
+{
+/// Serves daemon mode connections from a single process (--daemon_event_loop). All connections are multiplexed with
+/// epoll, complete lines received from every client are gathered into micro batches of up to max_batch_size examples
+/// and run through the one model of all, and each prediction is written back to the connection its example came from.
+///
+/// Only text input is supported. Only available on Linux; elsewhere the constructor throws.
+class event_daemon
+{
+public:
+  /// listen_fd must be a bound, listening TCP socket. It is not closed by the daemon.
+  event_daemon(VW::workspace& all, int listen_fd, size_t max_batch_size);
+  ~event_daemon();
+
+  event_daemon(const event_daemon&) = delete;
+  event_daemon& operator=(const event_daemon&) = delete;
+
+  /// Serves connections until stop() is called or the process receives SIGTERM.
+  void run();
+
+  /// Makes run() return once the batch in progress is finished. Safe to call from any thread.
+  void stop();
+
+  /// Number of connections currently open.
+  size_t num_connections() const;
+
+private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/// Runs an event_daemon on the socket bound by enable_sources until SIGTERM is received.
+void run_event_daemon(VW::workspace& all);
+}  // namespace details
+}  // namespace VW
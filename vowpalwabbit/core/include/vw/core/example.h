@@ -172,6 +172,10 @@ using example_factory_t = std::function<example&()>;
 
 namespace details
 {
+// empty_example keeps the feature buffers of an example for the next use of its pool slot, unless they hold more than
+// this many entries.
+constexpr size_t MAX_RETAINED_FEATURES = 1 << 16;
+
 void clean_example(VW::workspace& all, example& ec);
 
 void append_example_namespace(VW::example& ec, VW::namespace_index ns, const features& fs);
@@ -6,6 +6,7 @@
 #include "vw/common/future_compat.h"
 #include "vw/core/constant.h"
 #include "vw/core/feature_group.h"
+#include "vw/core/interaction_expansion_cache.h"
 #include "vw/core/reduction_features.h"
 #include "vw/core/v_array.h"
 
@@ -65,6 +66,9 @@ public:
   std::vector<std::vector<extent_term>>* extent_interactions = nullptr;
   reduction_features ex_reduction_features;
 
+  // Expanded interaction features, only filled in when --interaction_expansion_cache is on.
+  VW::details::interaction_expansion_cache interaction_expansions;
+
   // Used for debugging reductions.  Keeps track of current reduction level.
   uint32_t debug_current_reduction_depth = 0;
 };
@@ -488,6 +488,8 @@ public:
   }
 
   void clear();
+  // Like clear(), but keeps the buffers of values and indices allocated so that refilling them does not allocate.
+  void clear_noshrink();
   // These 3 overloads can be used if the sum_feat_sq of the removed section is known to avoid recalculating.
   void truncate_to(const audit_iterator& pos, float sum_feat_sq_of_removed_section);
   void truncate_to(const iterator& pos, float sum_feat_sq_of_removed_section);
@@ -498,6 +500,8 @@ public:
   void concat(const features& other);
   void push_back(feature_value v, feature_index i);
   void push_back(feature_value v, feature_index i, uint64_t ns_hash);
+  // Appends count features without audit information in one go, same as calling push_back(v[k], i[k]) for each k.
+  void append(const feature_value* v, const feature_index* i, size_t count);
   bool sort(uint64_t parse_mask);
 
   void start_ns_extent(uint64_t hash);
@@ -151,6 +151,7 @@ public:
   bool save_resume;
   bool preserve_performance_counters;
   bool save_per_pass;
+  bool dense_model_layout = false;  // write dense weights as one aligned block which can be memory mapped on load
   std::string per_feature_regularizer_output;
   std::string per_feature_regularizer_text;
 };
@@ -178,6 +179,7 @@ public:
   bool random_positive_weights;  // for initialize_regressor w/ new_mf
   bool normal_weights;
   bool tnormal_weights;
+  bool mmap_model = false;  // memory map dense weight blocks of the initial regressor instead of reading them
   std::string per_feature_regularizer_input;
 };
 
@@ -219,6 +221,8 @@ class runtime_config
 public:
 #ifdef VW_FEAT_NETWORKING_ENABLED
   bool daemon;
+  bool daemon_event_loop = false;  // Serve all daemon connections from this process instead of forked children
+  size_t daemon_batch_size = 64;   // Max examples per micro batch with daemon_event_loop
 #endif
   bool vw_is_main = false;  // true if vw is executable; false in library mode
   bool training;            // Should I train if lable data is available?
@@ -226,7 +230,10 @@ public:
   size_t numpasses;
   bool default_bits;
   all_reduce_type selected_all_reduce_type;
+  bool sparse_all_reduce = false;  // Only exchange the non-zero entries when accumulating weights across nodes
   uint32_t hash_seed;
+  size_t learner_threads = 1;  // Number of threads running Hogwild updates in generic_driver
+  bool fuse_reduction_stack = true;  // Let the learners of the stack call each other directly, see learner::fuse_stack
 };
 
 class runtime_state
@@ -301,6 +308,9 @@ public:
   void learn(multi_ex&);
   void predict(example&);
   void predict(multi_ex&);
+  /// Predicts count single line examples in one pass down the reduction stack. Reductions which do not implement
+  /// batching predict the examples one at a time, so the predictions are the same as calling predict() on each.
+  void predict_batch(example* const* examples, size_t count);
   void finish_example(example&);
   void finish_example(multi_ex&);
 
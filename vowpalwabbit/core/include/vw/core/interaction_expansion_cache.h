@@ -0,0 +1,50 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/constant.h"
+#include "vw/core/feature_group.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+// The interaction features generated for one example and one set of interactions. Indices are stored without the
+// example's ft_offset so the same expansion serves every model offset.
+class interaction_expansion
+{
+public:
+  std::vector<std::vector<namespace_index>> interactions;
+  std::vector<std::vector<extent_term>> extent_interactions;
+  bool permutations = false;
+  uint64_t features_fingerprint = 0;
+  uint64_t last_used = 0;
+  bool valid = false;
+
+  std::vector<feature_index> indices;
+  std::vector<feature_value> values;
+};
+
+// Per example cache of interaction expansions, enabled with --interaction_expansion_cache. It holds one entry per
+// interaction set so that reductions which switch interactions between calls (e.g. automl) do not thrash it.
+class interaction_expansion_cache
+{
+public:
+  // Must be called whenever the features of the example change in a way that keeps the size of every namespace.
+  // Appending or removing features is detected on lookup.
+  void invalidate()
+  {
+    for (auto& entry : entries) { entry.valid = false; }
+  }
+
+  std::vector<interaction_expansion> entries;
+  uint64_t use_counter = 0;
+};
+}  // namespace details
+}  // namespace VW
@@ -52,6 +52,8 @@ public:
   std::vector<feature_gen_data> state_data;
   VW::moved_object_pool<extent_interaction_expansion_stack_item> frame_pool;
   std::stack<extent_interaction_expansion_stack_item> in_process_frames;
+  // Number of interaction sets to keep expanded per example, 0 disables the expansion cache.
+  size_t max_cached_expansions = 0;
 };
 }  // namespace details
 }  // namespace VW
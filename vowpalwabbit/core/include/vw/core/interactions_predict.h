@@ -12,6 +12,7 @@
 #include "vw/core/interaction_generation_state.h"
 #include "vw/core/object_pool.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <stack>
 #include <string>
@@ -403,38 +404,17 @@ size_t process_generic_interaction(const std::vector<VW::details::features_range
 }
 }  // namespace details
 
-// this templated function generates new features for given example and set of interactions
-// and passes each of them to given function FuncT()
-// it must be in header file to avoid compilation problems
-template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), bool audit,
-    void (*audit_func)(DataT&, const VW::audit_strings*),
-    class WeightsT>  // nullptr func can't be used as template param in old compilers
-inline void generate_interactions(const std::vector<std::vector<VW::namespace_index>>& interactions,
+namespace details
+{
+// Walks every interaction of ec and hands each run of generated features to kernel_func(begin, end, value, halfhash).
+// Returns the number of generated features.
+template <bool audit, typename KernelFuncT, typename AuditFuncT>
+size_t foreach_interaction(const std::vector<std::vector<VW::namespace_index>>& interactions,
     const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
-    DataT& dat, WeightsT& weights, size_t& num_features,
-    VW::details::generate_interactions_object_cache&
-        cache)  // default value removed to eliminate ambiguity in old complers
+    const KernelFuncT& inner_kernel_func, const AuditFuncT& depth_audit_func,
+    VW::details::generate_interactions_object_cache& cache)
 {
-  num_features = 0;
-  // often used values
-  const auto inner_kernel_func = [&](VW::features::const_audit_iterator begin, VW::features::const_audit_iterator end,
-                                     VW::feature_value value, VW::feature_index index)
-  {
-    details::inner_kernel<DataT, WeightOrIndexT, FuncT, audit, audit_func>(
-        dat, begin, end, ec.ft_offset, weights, value, index);
-  };
-
-  // MSVC warns about using constant 0 as function expression (C4353) when audit_func is nullptr
-  // This is a nonstandard extension but is safe here since audit_func is always a valid function
-  // pointer (either an actual audit function or dummy_func) when this lambda is called
-#ifdef _MSC_VER
-#  pragma warning(push)
-#  pragma warning(disable : 4353)
-#endif
-  const auto depth_audit_func = [&](const VW::audit_strings* audit_str) { audit_func(dat, audit_str); };
-#ifdef _MSC_VER
-#  pragma warning(pop)
-#endif
+  size_t num_features = 0;
 
   // current list of namespaces to interact.
   for (const auto& ns : interactions)
@@ -505,8 +485,152 @@ inline void generate_interactions(const std::vector<std::vector<VW::namespace_in
         },
         cache.in_process_frames, cache.frame_pool);
   }
+  return num_features;
 }  // foreach interaction in all.feature_tweaks_config.interactions
 
+// Cheap summary of the features of ec, used to notice that features were added or removed since an expansion was
+// cached. Edits which keep every namespace the same size must call interaction_expansion_cache::invalidate().
+inline uint64_t features_fingerprint(const VW::example_predict& ec)
+{
+  uint64_t fingerprint = ec.indices.size();
+  for (const auto ns : ec.indices)
+  {
+    const auto& fs = ec.feature_space[ns];
+    fingerprint = fingerprint * VW::details::FNV_PRIME ^ ns;
+    fingerprint = fingerprint * VW::details::FNV_PRIME ^ fs.size();
+    fingerprint = fingerprint * VW::details::FNV_PRIME ^ reinterpret_cast<uintptr_t>(fs.values.data());
+    if (!fs.indices.empty())
+    {
+      fingerprint = fingerprint * VW::details::FNV_PRIME ^ fs.indices[0];
+      fingerprint = fingerprint * VW::details::FNV_PRIME ^ fs.indices[fs.indices.size() - 1];
+    }
+  }
+  return fingerprint;
+}
+
+// Returns the cached expansion of ec for the given interactions, expanding and caching it first if needed.
+inline const interaction_expansion& get_or_expand_interactions(
+    const std::vector<std::vector<VW::namespace_index>>& interactions,
+    const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
+    VW::details::generate_interactions_object_cache& cache)
+{
+  auto& expansions = ec.interaction_expansions;
+  const uint64_t fingerprint = features_fingerprint(ec);
+  const uint64_t now = ++expansions.use_counter;
+
+  interaction_expansion* slot = nullptr;
+  for (auto& entry : expansions.entries)
+  {
+    if (entry.valid && entry.permutations == permutations && entry.interactions == interactions &&
+        entry.extent_interactions == extent_interactions)
+    {
+      if (entry.features_fingerprint == fingerprint)
+      {
+        entry.last_used = now;
+        return entry;
+      }
+      slot = &entry;
+      break;
+    }
+  }
+
+  if (slot == nullptr)
+  {
+    // Prefer an entry invalidated by empty_example, then a new entry, then evict the least recently used one.
+    auto it = std::find_if(expansions.entries.begin(), expansions.entries.end(),
+        [](const interaction_expansion& entry) { return !entry.valid; });
+    if (it == expansions.entries.end())
+    {
+      if (expansions.entries.size() < cache.max_cached_expansions)
+      {
+        it = expansions.entries.emplace(expansions.entries.end());
+      }
+      else
+      {
+        it = std::min_element(expansions.entries.begin(), expansions.entries.end(),
+            [](const interaction_expansion& lhs, const interaction_expansion& rhs)
+            { return lhs.last_used < rhs.last_used; });
+      }
+    }
+    slot = &*it;
+    slot->interactions = interactions;
+    slot->extent_interactions = extent_interactions;
+    slot->permutations = permutations;
+  }
+
+  slot->indices.clear();
+  slot->values.clear();
+  const auto record_func = [slot](VW::features::const_audit_iterator begin, VW::features::const_audit_iterator end,
+                               VW::feature_value value, VW::feature_index halfhash)
+  {
+    for (; begin != end; ++begin)
+    {
+      slot->indices.push_back(begin.index() ^ halfhash);
+      slot->values.push_back(interaction_value(value, begin.value()));
+    }
+  };
+  const auto no_audit_func = [](const VW::audit_strings*) {};
+  foreach_interaction<false>(interactions, extent_interactions, permutations, ec, record_func, no_audit_func, cache);
+
+  slot->features_fingerprint = fingerprint;
+  slot->last_used = now;
+  slot->valid = true;
+  return *slot;
+}
+}  // namespace details
+
+// this templated function generates new features for given example and set of interactions
+// and passes each of them to given function FuncT()
+// it must be in header file to avoid compilation problems
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), bool audit,
+    void (*audit_func)(DataT&, const VW::audit_strings*),
+    class WeightsT>  // nullptr func can't be used as template param in old compilers
+inline void generate_interactions(const std::vector<std::vector<VW::namespace_index>>& interactions,
+    const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
+    DataT& dat, WeightsT& weights, size_t& num_features,
+    VW::details::generate_interactions_object_cache&
+        cache)  // default value removed to eliminate ambiguity in old complers
+{
+  // Audit needs the audit strings of every source feature, so it always expands from scratch.
+  if (!audit && cache.max_cached_expansions > 0 && (!interactions.empty() || !extent_interactions.empty()))
+  {
+    const auto& expansion =
+        details::get_or_expand_interactions(interactions, extent_interactions, permutations, ec, cache);
+    const uint64_t offset = ec.ft_offset;
+    const VW::feature_index* indices = expansion.indices.data();
+    const VW::feature_value* values = expansion.values.data();
+    num_features = expansion.indices.size();
+    for (size_t i = 0; i < num_features; ++i)
+    {
+      details::call_func_t<DataT, FuncT>(dat, weights, values[i], indices[i] + offset);
+    }
+    return;
+  }
+
+  // often used values
+  const auto inner_kernel_func = [&](VW::features::const_audit_iterator begin, VW::features::const_audit_iterator end,
+                                     VW::feature_value value, VW::feature_index index)
+  {
+    details::inner_kernel<DataT, WeightOrIndexT, FuncT, audit, audit_func>(
+        dat, begin, end, ec.ft_offset, weights, value, index);
+  };
+
+  // MSVC warns about using constant 0 as function expression (C4353) when audit_func is nullptr
+  // This is a nonstandard extension but is safe here since audit_func is always a valid function
+  // pointer (either an actual audit function or dummy_func) when this lambda is called
+#ifdef _MSC_VER
+#  pragma warning(push)
+#  pragma warning(disable : 4353)
+#endif
+  const auto depth_audit_func = [&](const VW::audit_strings* audit_str) { audit_func(dat, audit_str); };
+#ifdef _MSC_VER
+#  pragma warning(pop)
+#endif
+
+  num_features = details::foreach_interaction<audit>(
+      interactions, extent_interactions, permutations, ec, inner_kernel_func, depth_audit_func, cache);
+}
+
 }  // namespace VW
 
 namespace INTERACTIONS  // NOLINT
@@ -135,6 +135,7 @@ public:
   {
     assert(_input_files.empty());
     _output_files.push_back(std::move(file));
+    _flushed_bytes = 0;
   }
 
   /**
@@ -196,6 +197,15 @@ public:
 
   void flush();
 
+  /// Number of bytes written to the current output file so far including the ones not yet flushed. Only meaningful in
+  /// write mode.
+  size_t bytes_written() const { return _flushed_bytes + (_head - _buffer.begin); }
+
+  /// Memory maps the next len bytes of the input with copy on write semantics and skips past them. Returns nullptr,
+  /// without consuming anything, if there is not exactly one input file, the file cannot be mapped or the content is
+  /// being hashed.
+  std::shared_ptr<char> map_copy_on_write(size_t len);
+
   bool close_file()
   {
     if (!_input_files.empty())
@@ -207,6 +217,7 @@ public:
     if (!_output_files.empty())
     {
       _output_files.pop_back();
+      _flushed_bytes = 0;
       return true;
     }
 
@@ -374,6 +385,7 @@ private:
 
   // file descriptor currently being used.
   size_t _current = 0;
+  size_t _flushed_bytes = 0;
 
   std::vector<std::unique_ptr<VW::io::reader>> _input_files;
   std::vector<std::unique_ptr<VW::io::writer>> _output_files;
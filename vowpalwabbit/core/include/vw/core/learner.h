@@ -67,6 +67,9 @@ using void_func = std::function<void(void)>;
 using example_func = std::function<void(polymorphic_ex ex)>;
 using multipredict_func =
     std::function<void(polymorphic_ex ex, size_t count, size_t step, polyprediction* pred, bool finalize_predictions)>;
+using multiupdate_func = std::function<void(
+    polymorphic_ex ex, size_t count, size_t step, const float* labels, const polyprediction* pred)>;
+using predict_batch_func = std::function<void(example* const* examples, size_t count)>;
 
 using sensitivity_func = std::function<float(example& ex)>;
 using save_load_func = std::function<void(io_buf&, bool read, bool text)>;
@@ -96,6 +99,50 @@ using add_subtract_with_all_func = std::function<void(const VW::workspace& ws1,
 
 void debug_increment_depth(polymorphic_ex ex);
 void debug_decrement_depth(polymorphic_ex ex);
+// A learn or predict function of one learner together with the objects it was bound to. Fused stacks call through
+// this instead of the std::function, see learner::fuse_stack(). The thunk casts fn back to the type it was set with.
+class direct_call
+{
+public:
+  using thunk_func = void (*)(const direct_call& call, polymorphic_ex ex);
+
+  thunk_func thunk = nullptr;
+  void (*fn)() = nullptr;
+  void* data = nullptr;
+  learner* base = nullptr;
+
+  void operator()(polymorphic_ex ex) const { thunk(*this, ex); }
+};
+
+template <class DataT, class ExampleT>
+void reduction_thunk(const direct_call& call, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(DataT&, learner&, ExampleT&)>(call.fn)(*static_cast<DataT*>(call.data), *call.base, ex);
+}
+
+template <class ExampleT>
+void reduction_no_data_thunk(const direct_call& call, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(learner&, ExampleT&)>(call.fn)(*call.base, ex);
+}
+
+template <class DataT, class ExampleT>
+void bottom_thunk(const direct_call& call, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(DataT&, ExampleT&)>(call.fn)(*static_cast<DataT*>(call.data), ex);
+}
+
+template <class FnT>
+direct_call make_direct_call(direct_call::thunk_func thunk, FnT fn, void* data, learner* base)
+{
+  direct_call call;
+  call.thunk = thunk;
+  call.fn = reinterpret_cast<void (*)()>(fn);
+  call.data = data;
+  call.base = base;
+  return call;
+}
+
 void increment_offset(polymorphic_ex ex, const size_t feature_width_below, const size_t i);
 void decrement_offset(polymorphic_ex ex, const size_t feature_width_below, const size_t i);
 
@@ -177,8 +224,22 @@ public:
 
   void multipredict(polymorphic_ex ec, size_t lo, size_t count, polyprediction* pred, bool finalize_predictions);
 
+  /// \brief Make a prediction for each of count single line examples.
+  /// Learners which implement batching see the whole batch in one call, the
+  /// rest fall back to calling predict() on each example in turn.
+  /// \param examples Pointer to count examples, each of which must be set up as for predict().
+  /// \param i This is the offset used for the feature_width in this call.
+  void predict_batch(example* const* examples, size_t count, size_t i = 0);
+
   void update(polymorphic_ex ec, size_t i = 0);
 
+  /// \brief Update count consecutive regressors, starting at offset lo, as if update() were called for each of them.
+  /// Learners which implement it generate the features of ec once for all of them, the rest fall back to calling
+  /// update() for each regressor in turn.
+  /// \param labels The simple label to update each regressor towards.
+  /// \param pred The prediction each regressor made for ec, as used by update().
+  void multiupdate(example& ec, size_t lo, size_t count, const float* labels, const polyprediction* pred);
+
   float sensitivity(example& ec, size_t i = 0);
 
   // Called anytime saving or loading needs to happen. Autorecursive.
@@ -216,6 +277,13 @@ public:
 
   void cleanup_example(polymorphic_ex ec);
 
+  /// \brief Lets learn() and predict() with offset 0 call straight into this learner and every learner below it,
+  /// skipping the std::function and the offset bookkeeping of each layer. Stacks built with debug stack tracking
+  /// are left dynamic.
+  /// \returns The number of fused learners.
+  size_t fuse_stack();
+  VW_ATTR(nodiscard) bool is_fused() const { return _fused; }
+
   void get_enabled_learners(std::vector<std::string>& enabled_learners) const;
   learner* get_learner_by_name_prefix(const std::string& learner_name);
 
@@ -278,8 +346,15 @@ private:
   details::example_func _predict_f;
   details::example_func _update_f;
   details::multipredict_func _multipredict_f;
+  details::multiupdate_func _multiupdate_f;
+  details::predict_batch_func _predict_batch_f;
   details::sensitivity_func _sensitivity_f;
 
+  // The same functions as _learn_f and _predict_f, called directly once the stack is fused.
+  details::direct_call _learn_direct;
+  details::direct_call _predict_direct;
+  bool _fused = false;
+
   details::finish_example_func _finish_example_f;
   details::update_stats_func _update_stats_f;
   details::output_example_prediction_func _output_example_prediction_f;
@@ -567,6 +642,8 @@ public:
     DataT* data = this->learner_data.get();
     learner* base = this->learner_ptr->get_base_learner();
     this->learner_ptr->_predict_f = [fn_ptr, data, base](polymorphic_ex ex) { fn_ptr(*data, *base, ex); };
+    this->learner_ptr->_predict_direct =
+        details::make_direct_call(details::reduction_thunk<DataT, ExampleT>, fn_ptr, data, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(DataT&, learner&, ExampleT&)),
@@ -574,6 +651,8 @@ public:
     DataT* data = this->learner_data.get();
     learner* base = this->learner_ptr->get_base_learner();
     this->learner_ptr->_learn_f = [fn_ptr, data, base](polymorphic_ex ex) { fn_ptr(*data, *base, ex); };
+    this->learner_ptr->_learn_direct =
+        details::make_direct_call(details::reduction_thunk<DataT, ExampleT>, fn_ptr, data, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict(void (*fn_ptr)(DataT&, learner&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -585,6 +664,24 @@ public:
     { fn_ptr(*data, *base, ex, count, step, pred, finalize_predictions); };
   )
 
+  LEARNER_BUILDER_DEFINE(set_multiupdate(void (*fn_ptr)(DataT&, learner&, ExampleT&, size_t, size_t, const float*,
+                             const polyprediction*)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    learner* base = this->learner_ptr->get_base_learner();
+    this->learner_ptr->_multiupdate_f = [fn_ptr, data, base](polymorphic_ex ex, size_t count, size_t step,
+        const float* labels, const polyprediction* pred)
+    { fn_ptr(*data, *base, ex, count, step, labels, pred); };
+  )
+
+  LEARNER_BUILDER_DEFINE(set_predict_batch(void (*fn_ptr)(DataT&, learner&, example* const*, size_t)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    learner* base = this->learner_ptr->get_base_learner();
+    this->learner_ptr->_predict_batch_f = [fn_ptr, data, base](example* const* examples, size_t count)
+    { fn_ptr(*data, *base, examples, count); };
+  )
+
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(DataT& data, learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
@@ -675,12 +772,16 @@ public:
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
     this->learner_ptr->_predict_f = [fn_ptr, base](polymorphic_ex ex) { fn_ptr(*base, ex); };
+    this->learner_ptr->_predict_direct =
+        details::make_direct_call(details::reduction_no_data_thunk<ExampleT>, fn_ptr, nullptr, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
     this->learner_ptr->_learn_f = [fn_ptr, base](polymorphic_ex ex) { fn_ptr(*base, ex); };
+    this->learner_ptr->_learn_direct =
+        details::make_direct_call(details::reduction_no_data_thunk<ExampleT>, fn_ptr, nullptr, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict(void (*fn_ptr)(learner&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -691,6 +792,22 @@ public:
     { fn_ptr(*base, ex, count, step, pred, finalize_predictions); };
   )
 
+  LEARNER_BUILDER_DEFINE(set_multiupdate(void (*fn_ptr)(learner&, ExampleT&, size_t, size_t, const float*,
+                             const polyprediction*)),
+    assert(fn_ptr != nullptr);
+    learner* base = this->learner_ptr->get_base_learner();
+    this->learner_ptr->_multiupdate_f =
+        [fn_ptr, base](polymorphic_ex ex, size_t count, size_t step, const float* labels, const polyprediction* pred)
+    { fn_ptr(*base, ex, count, step, labels, pred); };
+  )
+
+  LEARNER_BUILDER_DEFINE(set_predict_batch(void (*fn_ptr)(learner&, example* const*, size_t)),
+    assert(fn_ptr != nullptr);
+    learner* base = this->learner_ptr->get_base_learner();
+    this->learner_ptr->_predict_batch_f = [fn_ptr, base](example* const* examples, size_t count)
+    { fn_ptr(*base, examples, count); };
+  )
+
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
@@ -738,12 +855,16 @@ public:
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
     this->learner_ptr->_predict_f = [fn_ptr, data](polymorphic_ex ex) { fn_ptr(*data, ex); };
+    this->learner_ptr->_predict_direct =
+        details::make_direct_call(details::bottom_thunk<DataT, ExampleT>, fn_ptr, data, nullptr);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(DataT&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
     this->learner_ptr->_learn_f = [fn_ptr, data](polymorphic_ex ex) { fn_ptr(*data, ex); };
+    this->learner_ptr->_learn_direct =
+        details::make_direct_call(details::bottom_thunk<DataT, ExampleT>, fn_ptr, data, nullptr);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict( void (*fn_ptr)(DataT&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -754,6 +875,22 @@ public:
     { fn_ptr(*data, ex, count, step, pred, finalize_predictions); };
   )
 
+  LEARNER_BUILDER_DEFINE(set_multiupdate(void (*fn_ptr)(DataT&, ExampleT&, size_t, size_t, const float*,
+                             const polyprediction*)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    this->learner_ptr->_multiupdate_f =
+        [fn_ptr, data](polymorphic_ex ex, size_t count, size_t step, const float* labels, const polyprediction* pred)
+    { fn_ptr(*data, ex, count, step, labels, pred); };
+  )
+
+  LEARNER_BUILDER_DEFINE(set_predict_batch(void (*fn_ptr)(DataT&, example* const*, size_t)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    this->learner_ptr->_predict_batch_f = [fn_ptr, data](example* const* examples, size_t count)
+    { fn_ptr(*data, examples, count); };
+  )
+
 
 
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(DataT& data, ExampleT&)),
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "vw/common/random.h"
+#include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_sparse.h"
 #include "vw/core/learner.h"
 
 namespace VW
@@ -82,6 +84,54 @@ inline void move_innermost_offsets(dense_parameters& weights, const size_t from,
   }
 }
 
+// Sparse weights give each model its own slabs (see sparse_parameters::set_model_width()), so the weights of a model are
+// released, copied or swapped as a whole instead of being walked. Here a model is one offset in the total_feature_width.
+inline void clear_innermost_offset(sparse_parameters& weights, const size_t offset, const size_t total_feature_width,
+    const size_t innermost_feature_width_size)
+{
+  assert(offset < innermost_feature_width_size);
+  for (size_t outer_offset = 0; outer_offset < total_feature_width / innermost_feature_width_size; ++outer_offset)
+  {
+    weights.release_model(outer_offset * innermost_feature_width_size + offset);
+  }
+}
+
+inline void move_innermost_offsets(sparse_parameters& weights, const size_t from, const size_t to,
+    const size_t total_feature_width, const size_t innermost_feature_width_size, bool swap = false)
+{
+  assert(from < innermost_feature_width_size);
+  assert(to < innermost_feature_width_size);
+  for (size_t outer_offset = 0; outer_offset < total_feature_width / innermost_feature_width_size; ++outer_offset)
+  {
+    const size_t outer_model = outer_offset * innermost_feature_width_size;
+    if (swap) { weights.swap_models(outer_model + from, outer_model + to); }
+    else { weights.copy_model(outer_model + from, outer_model + to); }
+  }
+}
+
+inline void clear_innermost_offset(VW::parameters& weights, const size_t offset, const size_t total_feature_width,
+    const size_t innermost_feature_width_size)
+{
+  if (weights.sparse)
+  {
+    clear_innermost_offset(weights.sparse_weights, offset, total_feature_width, innermost_feature_width_size);
+  }
+  else { clear_innermost_offset(weights.dense_weights, offset, total_feature_width, innermost_feature_width_size); }
+}
+
+inline void move_innermost_offsets(VW::parameters& weights, const size_t from, const size_t to,
+    const size_t total_feature_width, const size_t innermost_feature_width_size, bool swap = false)
+{
+  if (weights.sparse)
+  {
+    move_innermost_offsets(weights.sparse_weights, from, to, total_feature_width, innermost_feature_width_size, swap);
+  }
+  else
+  {
+    move_innermost_offsets(weights.dense_weights, from, to, total_feature_width, innermost_feature_width_size, swap);
+  }
+}
+
 /* This function is used to select one sub-offset within the innermost feature_width and remove all others. For instance
  if this called with "--bag 4 --automl 2" using offset = 1 (we will have innermost_feature_width_size = 2 and
  total_feature_width = 8) then this will remove all weights with automl = 0. The set of weights referenced above:
@@ -7,9 +7,10 @@
 #include "vw/common/future_compat.h"
 
 #include <cassert>
-#include <queue>
+#include <memory>
 #include <stack>
 #include <unordered_set>
+#include <vector>
 
 // Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
 // project.
@@ -59,7 +60,8 @@ public:
   object_pool_impl() = default;
   object_pool_impl(size_t initial_size, TFactory factory = {}) : _factory(factory)
   {
-    for (size_t i = 0; i < initial_size; ++i) { _pool.push(allocate_new()); }
+    _pool.reserve(initial_size);
+    for (size_t i = 0; i < initial_size; ++i) { _pool.push_back(allocate_new()); }
   }
 
   ~object_pool_impl() { assert(_pool.size() == size()); }
@@ -67,13 +69,13 @@ public:
   void return_object(T* obj)
   {
     std::unique_lock<TMutex> lock(_lock);
-    _pool.push(std::unique_ptr<T>(obj));
+    _pool.emplace_back(obj);
   }
 
   void return_object(std::unique_ptr<T> obj)
   {
     std::unique_lock<TMutex> lock(_lock);
-    _pool.push(std::move(obj));
+    _pool.push_back(std::move(obj));
   }
 
   std::unique_ptr<T> get_object()
@@ -81,8 +83,9 @@ public:
     std::unique_lock<TMutex> lock(_lock);
     if (_pool.empty()) { return allocate_new(); }
 
-    auto obj = std::move(_pool.front());
-    _pool.pop();
+    // Hand out the most recently returned object, its memory is the most likely to still be cached.
+    auto obj = std::move(_pool.back());
+    _pool.pop_back();
     return obj;
   }
 
@@ -118,7 +121,8 @@ private:
   mutable TMutex _lock;
   TFactory _factory;
   std::unordered_set<const T*> _allocated_by_pool;
-  std::queue<std::unique_ptr<T>> _pool;
+  // A stack instead of a queue, so that returning and taking objects does not allocate once the pool is warm.
+  std::vector<std::unique_ptr<T>> _pool;
 };
 
 }  // namespace details
@@ -0,0 +1,139 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/common/string_view.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/label_parser.h"
+#include "vw/core/multi_ex.h"
+#include "vw/core/vw_fwd.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
+// project.
+#ifdef _M_CEE
+#  pragma managed(push, off)
+#  undef _M_CEE
+#  include <condition_variable>
+#  include <mutex>
+#  define _M_CEE 001
+#  pragma managed(pop)
+#else
+#  include <condition_variable>
+#  include <mutex>
+#endif
+
+namespace VW
+{
+namespace details
+{
+/// Parses text format or cache input on several threads while handing examples to the caller in input order.
+///
+/// The thread calling read() (the parse thread) is the only producer: it reads raw records, a line of text or one
+/// length prefixed cached example, from the io_buf into a bounded ring of slots, each tagged with a monotonically
+/// increasing sequence number. Splitting the input into records is cheap, the expensive part is decoding them. Worker
+/// threads claim slots with a compare and swap on the claim counter and turn the record into an example. The parse thread consumes slots strictly
+/// in sequence order and helps parsing while it waits, so the examples, and therefore everything done to them later in
+/// setup_example and the learner, are identical to the single threaded reader.
+///
+/// The hot path takes no locks. Idle workers park on a condition variable which the producer only touches when a
+/// worker is actually parked.
+class parallel_parser
+{
+public:
+  enum class record_format
+  {
+    TEXT,
+    CACHE
+  };
+
+  parallel_parser(VW::workspace& all, size_t num_threads, size_t ring_size);
+  ~parallel_parser();
+
+  parallel_parser(const parallel_parser&) = delete;
+  parallel_parser& operator=(const parallel_parser&) = delete;
+  parallel_parser(parallel_parser&&) = delete;
+  parallel_parser& operator=(parallel_parser&&) = delete;
+
+  /// Has the same contract as VW::parser::reader. examples must contain a single unused example. On success
+  /// examples[0] is replaced with the next parsed example in input order and the number of bytes consumed for that
+  /// record is returned. Returns 0 and leaves examples untouched once the input is exhausted and all records read
+  /// ahead have been handed out. New records are read in the given format, the input may only change format after
+  /// discard_pending() or once it is exhausted.
+  int read(io_buf& buf, VW::multi_ex& examples, record_format format);
+
+  /// Returns every example that was read ahead but not yet handed out to the example pool. Must be called on the
+  /// parse thread, or after it has exited, whenever the input is reset before it was exhausted.
+  void discard_pending();
+
+  size_t num_threads() const { return _workers.size(); }
+
+private:
+  enum slot_state : uint32_t
+  {
+    EMPTY = 0,
+    PARSED = 1
+  };
+
+  class slot
+  {
+  public:
+    std::vector<char> record;
+    record_format format = record_format::TEXT;
+    VW::example* ex = nullptr;
+    size_t bytes_consumed = 0;
+    std::exception_ptr exc;
+    std::atomic<uint32_t> state{EMPTY};
+  };
+
+  class worker_scratch
+  {
+  public:
+    std::vector<VW::string_view> words;
+    VW::label_parser_reuse_mem reuse_mem;
+    VW::io_buf record_buf;
+    VW::multi_ex examples;
+  };
+
+  void worker_loop(size_t worker_index);
+  // Claims and parses the oldest unclaimed slot. Returns false if there was nothing to claim.
+  bool try_parse_one(worker_scratch& scratch);
+  // Reads the next record into s. Returns false once the input is exhausted.
+  bool read_record(io_buf& buf, slot& s, record_format format);
+  void wake_workers();
+
+  VW::workspace& _all;
+  std::vector<slot> _slots;
+  uint64_t _mask;
+
+  // _head is only touched by the parse thread, _tail is published by it and _claim is shared by everyone parsing.
+  uint64_t _head = 0;
+  std::atomic<uint64_t> _tail{0};
+  std::atomic<uint64_t> _claim{0};
+  bool _input_exhausted = false;
+
+  // Unused examples that were passed in while the ring was full, reused before taking new ones from the pool.
+  std::deque<VW::example*> _spare_examples;
+
+  std::vector<worker_scratch> _scratch;
+  std::vector<std::thread> _workers;
+  std::atomic<bool> _stop{false};
+  std::atomic<size_t> _num_parked{0};
+  std::mutex _park_mutex;
+  std::condition_variable _park_cv;
+};
+
+int read_features_string_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
+int read_example_from_cache_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
+}  // namespace details
+}  // namespace VW
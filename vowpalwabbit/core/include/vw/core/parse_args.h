@@ -25,6 +25,8 @@ public:
   std::string pid_file;
   std::string port_file;
   uint64_t num_children;
+  bool daemon_event_loop = false;
+  uint64_t daemon_batch_size = 64;
   // If a model was saved in daemon or active learning mode, force it to accept
   // local input when loaded instead.
   bool no_daemon = false;
@@ -38,6 +38,11 @@ void parse_dispatch(VW::workspace& all, DispatchFuncT& dispatch)
       }
       else
       {
+        // Examples read ahead past the end of the pass must not leak into the next one.
+        if (all.parser_runtime.example_parser->parallel != nullptr)
+        {
+          all.parser_runtime.example_parser->parallel->discard_pending();
+        }
         VW::details::reset_source(all, all.initial_weights_config.num_bits);
         all.runtime_state.do_reset_source = false;
         all.runtime_state.passes_complete++;
@@ -14,6 +14,8 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 namespace VW
@@ -29,6 +31,17 @@ std::vector<std::string> escaped_tokenize(char delim, VW::string_view s, bool al
 //  - much faster (around 50% but depends on the  string to parse)
 //  - less error control, but utilised inside a very strict parser
 //    in charge of error detection.
+// The result is still correctly rounded: decimals whose significand fits in a float and whose exponent is small are
+// converted with a single exact float operation (Clinger's fast path), other significands of up to 19 digits by
+// decimal_to_float and all others are handed to strtof.
+constexpr uint64_t MAX_EXACT_FLOAT_SIGNIFICAND = static_cast<uint64_t>(1) << 24;
+constexpr int MAX_EXACT_FLOAT_POW10 = 10;
+constexpr float EXACT_FLOAT_POW10[MAX_EXACT_FLOAT_POW10 + 1] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+// Returns significand * 10^exponent correctly rounded to a float, using the Eisel-Lemire algorithm.
+float decimal_to_float(uint64_t significand, int exponent);
+
 inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char* end_line = nullptr)
 {
   const char* start = p;
@@ -46,19 +59,24 @@ inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char
     p++;
   }
 
-  float acc = 0;
-  while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line)) { acc = acc * 10 + *p++ - '0'; }
+  // Leading zeros do not count as significant digits. More than 19 of them overflow the significand, which then only
+  // serves to take the strtof path below.
+  uint64_t significand = 0;
+  int num_digits = 0;
+  while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line))
+  {
+    significand = significand * 10 + (*p++ - '0');
+    if (significand != 0) { num_digits++; }
+  }
 
   int num_dec = 0;
   if (*p == '.')
   {
     while (*(++p) >= '0' && *p <= '9' && (end_line_is_null || p < end_line))
     {
-      if (num_dec < 35)
-      {
-        acc = acc * 10 + (*p - '0');
-        num_dec++;
-      }
+      significand = significand * 10 + (*p - '0');
+      if (significand != 0) { num_digits++; }
+      num_dec++;
     }
   }
 
@@ -77,18 +95,44 @@ inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char
   }
   if (*p == ' ' || *p == '\n' || *p == '\t' || p == end_line)  // easy case succeeded.
   {
-    acc *= VW::fast_pow10(static_cast<int8_t>(exp_acc - num_dec));
-    end_idx = p - start;
-    return s * acc;
-  }
-  else
-  {
-    // can't use stod because that throws an exception. Use strtod instead.
-    char* end = nullptr;
-    auto ret = strtof(start, &end);
-    if (end >= start) { end_idx = end - start; }
-    return ret;
+    const size_t length = p - start;
+    const int exponent = exp_acc - num_dec;
+    if (significand == 0)
+    {
+      end_idx = length;
+      return s * 0.f;
+    }
+    if (num_digits <= 19 && significand <= MAX_EXACT_FLOAT_SIGNIFICAND && exponent >= -MAX_EXACT_FLOAT_POW10 &&
+        exponent <= MAX_EXACT_FLOAT_POW10)
+    {
+      // Both operands are exact, so the IEEE operation rounds the exact decimal value correctly.
+      const float value = exponent < 0 ? static_cast<float>(significand) / EXACT_FLOAT_POW10[-exponent]
+                                       : static_cast<float>(significand) * EXACT_FLOAT_POW10[exponent];
+      end_idx = length;
+      return s * value;
+    }
+    if (num_digits <= 19)
+    {
+      end_idx = length;
+      return s * decimal_to_float(significand, exponent);
+    }
+
+    // The significand has too many digits. strtof gets a terminated copy so it stops at end_line.
+    char buffer[64];
+    if (length < sizeof(buffer))
+    {
+      std::memcpy(buffer, start, length);
+      buffer[length] = '\0';
+      end_idx = length;
+      return strtof(buffer, nullptr);
+    }
   }
+
+  // can't use stod because that throws an exception. Use strtod instead.
+  char* end = nullptr;
+  auto ret = strtof(start, &end);
+  if (end >= start) { end_idx = end - start; }
+  return ret;
 }
 
 inline float float_of_string(VW::string_view s, VW::io::logger& logger)
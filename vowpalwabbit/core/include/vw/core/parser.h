@@ -24,6 +24,7 @@
 #include "vw/core/hashstring.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/object_pool.h"
+#include "vw/core/parallel_parser.h"
 #include "vw/core/queue.h"
 #include "vw/core/vw_fwd.h"
 
@@ -105,6 +106,10 @@ public:
   bool strict_parse;
   std::exception_ptr exc_ptr;
   std::unique_ptr<details::dsjson_metrics> metrics = nullptr;
+
+  // Number of threads parsing text or cache input, see --parse_threads.
+  size_t num_parse_threads = 1;
+  std::unique_ptr<details::parallel_parser> parallel = nullptr;
 };
 namespace details
 {
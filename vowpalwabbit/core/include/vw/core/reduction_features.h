@@ -10,6 +10,7 @@
 #include "vw/core/continuous_actions_reduction_features.h"
 #include "vw/core/epsilon_reduction_features.h"
 #include "vw/core/large_action_space_reduction_features.h"
+#include "vw/core/shared_feature_merger_reduction_features.h"
 #include "vw/core/simple_label.h"
 
 /*
@@ -51,6 +52,7 @@ public:
     _epsilon_reduction_features.reset_to_default();
     _large_action_space_reduction_features.reset_to_default();
     _cb_graph_feedback_reduction_features.clear();
+    _shared_feature_merger_reduction_features.clear();
   }
 
 private:
@@ -60,6 +62,7 @@ private:
   VW::cb_explore_adf::greedy::reduction_features _epsilon_reduction_features;
   VW::large_action_space::las_reduction_features _large_action_space_reduction_features;
   VW::cb_graph_feedback::reduction_features _cb_graph_feedback_reduction_features;
+  VW::shared_feature_merger::reduction_features _shared_feature_merger_reduction_features;
 };
 
 template <>
@@ -139,6 +142,20 @@ reduction_features::get<VW::cb_graph_feedback::reduction_features>() const
 {
   return _cb_graph_feedback_reduction_features;
 }
+
+template <>
+inline VW::shared_feature_merger::reduction_features&
+reduction_features::get<VW::shared_feature_merger::reduction_features>()
+{
+  return _shared_feature_merger_reduction_features;
+}
+
+template <>
+inline const VW::shared_feature_merger::reduction_features&
+reduction_features::get<VW::shared_feature_merger::reduction_features>() const
+{
+  return _shared_feature_merger_reduction_features;
+}
 }  // namespace VW
 
 using reduction_features VW_DEPRECATED("reduction_features moved into VW namespace") = VW::reduction_features;
\ No newline at end of file
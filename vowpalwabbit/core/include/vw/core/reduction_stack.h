@@ -36,6 +36,7 @@ private:
   VW::workspace* _all_ptr = nullptr;
   std::shared_ptr<VW::LEARNER::learner> _base;
   size_t _feature_width_above = 1;
+  size_t _setup_depth = 0;
 
 protected:
   std::vector<std::tuple<std::string, reduction_setup_fn>> _reduction_stack;
@@ -7,6 +7,7 @@
 #include "vw/common/random.h"
 #include "vw/common/string_view.h"
 #include "vw/core/feature_group.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw_fwd.h"
 
 #include <list>
@@ -53,7 +54,7 @@ emt_scorer_type emt_scorer_type_from_string(VW::string_view val);
 emt_router_type emt_router_type_from_string(VW::string_view val);
 emt_initial_type emt_initial_type_from_string(VW::string_view val);
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2);
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2);
 float emt_median(std::vector<float>&);
 float emt_inner(const emt_feats&, const emt_feats&);
 float emt_norm(const emt_feats&);
@@ -61,6 +62,7 @@ void emt_scale(emt_feats&, float);
 void emt_normalize(emt_feats&);
 emt_feats emt_scale_add(float, const emt_feats&, float, const emt_feats&);
 emt_feats emt_router_eigen(std::vector<emt_feats>&, VW::rand_state&);
+uint64_t emt_sketch(const emt_feats&);
 
 template <typename RandomIt>
 void emt_shuffle(RandomIt first, RandomIt last, VW::rand_state& rng)
@@ -83,6 +85,7 @@ struct emt_example
   emt_feats base;  // base example only includes the base features without interaction flags
   emt_feats full;  // full example includes the interactions that were passed in as flags
   uint32_t label = 0;
+  uint64_t sketch = 0;  // emt_sketch of full, only computed when the tree prefilters the memories of a leaf
 
   emt_example() = default;
   emt_example(VW::workspace&, VW::example*);
@@ -123,9 +126,16 @@ struct emt_tree
   emt_router_type router_type = emt_router_type::EIGEN;
   emt_initial_type initial_type = emt_initial_type::COSINE;
 
+  // how many memories of a leaf the scorer compares when predicting, picked by their sketches (0 compares all of them)
+  uint32_t prefilter = 0;
+  std::unique_ptr<VW::thread_pool> threads;  // builds the scorer examples of a leaf, null when running on one thread
+
   std::unique_ptr<VW::example> ex;  // we create one of these which we re-use so we don't have to reallocate examples
   std::unique_ptr<std::vector<std::vector<VW::namespace_index>>> empty_interactions_for_ex;
   std::unique_ptr<std::vector<std::vector<extent_term>>> empty_extent_interactions_for_ex;
+  // the same for scoring all the memories of a leaf in one batch, grown to the largest leaf seen
+  std::vector<std::unique_ptr<VW::example>> batch_exs;
+  std::vector<VW::example*> batch;
 
 #ifdef VW_ENABLE_EMT_DEBUG_TIMER
   int64_t begin = 0;  // for timing performance
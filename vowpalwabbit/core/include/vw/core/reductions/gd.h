@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "vw/core/accumulate.h"
 #include "vw/core/array_parameters.h"
 #include "vw/core/constant.h"
 #include "vw/core/example.h"
@@ -15,7 +16,10 @@
 // we need it for learner
 #include "vw/core/vw_fwd.h"
 
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace VW
 {
@@ -32,6 +36,24 @@ public:
   double normalized_sum_norm_x = 0.0;
   double total_weight = 0.0;
 };
+
+// Linear score of the shared features of the current multi example at each offset, see --cache_shared_score. Valid
+// while neither the multi example nor the weights changed.
+class gd_shared_score_cache
+{
+public:
+  uint64_t multi_ex_id = 0;
+  uint64_t weights_version = 0;
+  std::vector<std::pair<uint64_t, float>> scores;
+};
+
+// Explicit SIMD kernels used for the linear terms, see --gd_explicit_simd.
+enum class gd_simd_type
+{
+  NO_SIMD,
+  AVX2,
+  AVX512
+};
 }  // namespace details
 
 class gd
@@ -50,12 +72,19 @@ public:
   void (*predict)(gd&, VW::example&) = nullptr;
   void (*learn)(gd&, VW::example&) = nullptr;
   void (*update)(gd&, VW::example&) = nullptr;
+  void (*multiupdate)(gd&, VW::example&, size_t, size_t, const float*, const VW::polyprediction*) = nullptr;
   float (*sensitivity)(gd&, VW::example&) = nullptr;
   void (*multipredict)(gd&, VW::example&, size_t, size_t, VW::polyprediction*, bool) = nullptr;
+  void (*predict_batch)(gd&, VW::example* const*, size_t) = nullptr;
   bool adaptive_input = false;
   bool normalized_input = false;
   bool adax = false;
   bool per_model_save_load = false;
+  VW::reductions::details::gd_simd_type simd = VW::reductions::details::gd_simd_type::NO_SIMD;
+  uint64_t weights_version = 0;  // incremented by every update
+  VW::reductions::details::gd_shared_score_cache shared_scores;
+  bool async_all_reduce = false;
+  VW::details::async_accumulator async_average;  // end of pass average still in flight with async_all_reduce
   VW::workspace* all = nullptr;  // parallel, features, parameters
 };
 }  // namespace reductions
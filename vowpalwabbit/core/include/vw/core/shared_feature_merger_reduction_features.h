@@ -0,0 +1,45 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VW
+{
+namespace shared_feature_merger
+{
+// Features [begin, end) of namespace index of an action were appended from its shared example.
+class appended_range
+{
+public:
+  VW::namespace_index index;
+  size_t begin;
+  size_t end;
+};
+
+// Set on every action by shared_feature_merger when --cache_shared_score is enabled, so that the linear score of the
+// shared features can be computed once per multi example instead of once per action.
+class reduction_features
+{
+public:
+  const VW::example* shared_example = nullptr;
+  // Unique per call of shared_feature_merger, 0 when the shared example was not appended.
+  uint64_t multi_ex_id = 0;
+  std::vector<appended_range> appended;
+
+  void clear()
+  {
+    shared_example = nullptr;
+    multi_ex_id = 0;
+    appended.clear();
+  }
+};
+
+}  // namespace shared_feature_merger
+}  // namespace VW
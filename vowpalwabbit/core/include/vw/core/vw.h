@@ -36,6 +36,9 @@
 #include "vw/core/vw_fwd.h"
 
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 namespace VW
 {
@@ -126,6 +129,16 @@ std::unique_ptr<VW::workspace> seed_vw_model(VW::workspace& vw_model, const std:
     driver_output_func_t driver_output_func = nullptr, void* driver_output_func_context = nullptr,
     VW::io::logger* custom_logger = nullptr);
 
+namespace details
+{
+/// Creates a workspace with the options, and so the reduction stack, of master that learns into master's weights and
+/// shared_data object. Options that only make sense for master, such as its input, output and model files, are left
+/// out along with excluded_options. The replica has its own reduction state, so it can learn on another thread than
+/// master, with updates to the shared weights racing without any locking (Hogwild).
+std::unique_ptr<VW::workspace> create_replica(
+    VW::workspace& master, const std::set<std::string>& excluded_options = {});
+}  // namespace details
+
 VW_WARNING_STATE_PUSH
 VW_WARNING_DISABLE_BADLY_FORMED_XML
 /**
@@ -248,6 +261,13 @@ void return_features(feature* f);
 void add_constant_feature(const VW::workspace& all, example* ec);
 void add_label(example* ec, float label, float weight = 1, float base = 0);
 
+// predict many single line examples at once, same as calling all.predict() on each of them.
+void predict_batch(VW::workspace& all, example* const* examples, size_t count);
+inline void predict_batch(VW::workspace& all, const std::vector<example*>& examples)
+{
+  predict_batch(all, examples.data(), examples.size());
+}
+
 // notify VW that you are done with the example.
 void finish_example(VW::workspace& all, example& ec);
 void finish_example(VW::workspace& all, multi_ex& ec);
@@ -16,6 +16,7 @@ class reduction_features;
 class example;
 class kskip_ngram_transformer;
 class label_parser;
+class label_parser_reuse_mem;
 class polylabel;
 class rand_state;
 class setup_base_i;
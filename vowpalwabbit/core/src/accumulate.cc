@@ -13,15 +13,156 @@ Alekh Agarwal and John Langford, with help Olivier Chapelle.
 #include "vw/core/global_data.h"
 #include "vw/core/vw_allreduce.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 static void add_float(float& c1, const float& c2) { c1 += c2; }
 
+namespace
+{
+void add_uint64(uint64_t& c1, const uint64_t& c2) { c1 += c2; }
+void add_byte(uint8_t& c1, const uint8_t& c2) { c1 += c2; }
+
+// A non-zero entry is written as the varint encoded distance to the previous index followed by the raw float.
+void encode_entry(std::vector<uint8_t>& out, uint64_t delta, float value)
+{
+  while (delta >= 0x80)
+  {
+    out.push_back(static_cast<uint8_t>(delta | 0x80));
+    delta >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(delta));
+  uint8_t bytes[sizeof(float)];
+  std::memcpy(bytes, &value, sizeof(float));
+  out.insert(out.end(), bytes, bytes + sizeof(float));
+}
+
+template <class F>
+void for_each_entry(const uint8_t* begin, const uint8_t* end, F&& f)
+{
+  uint64_t index = 0;
+  while (begin < end)
+  {
+    uint64_t delta = 0;
+    for (unsigned int shift = 0;; shift += 7)
+    {
+      const uint8_t byte = *begin++;
+      delta |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) { break; }
+    }
+    float value;
+    std::memcpy(&value, begin, sizeof(float));
+    begin += sizeof(float);
+    index += delta;
+    f(index, value);
+  }
+}
+
+std::vector<uint8_t> encode_non_zero(VW::dense_parameters& weights, uint64_t length, size_t offset)
+{
+  std::vector<uint8_t> encoded;
+  uint64_t previous = 0;
+  for (uint64_t i = 0; i < length; i++)
+  {
+    const float value = (&weights.strided_index(i))[offset];
+    if (value != 0.f)
+    {
+      encode_entry(encoded, i - previous, value);
+      previous = i;
+    }
+  }
+  return encoded;
+}
+
+std::vector<uint8_t> encode_non_zero(VW::sparse_parameters& weights, uint64_t /* length */, size_t offset)
+{
+  // Only the stored weights can be non-zero, but the table is not ordered by index.
+  std::vector<std::pair<uint64_t, float>> entries;
+  for (auto it = weights.begin(); it != weights.end(); ++it)
+  {
+    const float value = (&(*it))[offset];
+    if (value != 0.f) { entries.emplace_back(it.index() >> weights.stride_shift(), value); }
+  }
+  std::sort(entries.begin(), entries.end());
+
+  std::vector<uint8_t> encoded;
+  uint64_t previous = 0;
+  for (const auto& entry : entries)
+  {
+    encode_entry(encoded, entry.first - previous, entry.second);
+    previous = entry.first;
+  }
+  return encoded;
+}
+
+// Sums the strided values at offset over all nodes by exchanging only the non-zero entries of each node, and divides
+// the sums by divisor. Returns false without touching the weights when the encoded entries of all nodes together are
+// not smaller than the dense vector, in which case the caller has to fall back to the dense all_reduce.
+template <class WeightsT>
+bool sparse_all_reduce(VW::workspace& all, WeightsT& weights, uint64_t length, size_t offset, float divisor)
+{
+  const auto& reducer = *all.runtime_state.all_reduce;
+  const auto encoded = encode_non_zero(weights, length, offset);
+
+  std::vector<uint64_t> sizes(reducer.total, 0);
+  sizes[reducer.node] = encoded.size();
+  VW::details::all_reduce<uint64_t, add_uint64>(all, sizes.data(), sizes.size());
+
+  // Every node sees the same sizes, so all of them take the same branch.
+  const uint64_t total_size = std::accumulate(sizes.begin(), sizes.end(), static_cast<uint64_t>(0));
+  if (total_size >= length * sizeof(float)) { return false; }
+
+  // The nodes write their entries to disjoint ranges of a zeroed buffer, so summing the buffers gathers all of them.
+  std::vector<uint8_t> gathered(total_size, 0);
+  const uint64_t own_begin =
+      std::accumulate(sizes.begin(), sizes.begin() + reducer.node, static_cast<uint64_t>(0));
+  std::copy(encoded.begin(), encoded.end(), gathered.begin() + own_begin);
+  if (total_size > 0) { VW::details::all_reduce<uint8_t, add_byte>(all, gathered.data(), gathered.size()); }
+
+  // The local entries are cleared and the entries of every node are added back in node order, which gives all nodes
+  // bitwise identical sums.
+  for_each_entry(encoded.data(), encoded.data() + encoded.size(),
+      [&weights, offset](uint64_t i, float) { (&weights.strided_index(i))[offset] = 0.f; });
+  const uint8_t* region = gathered.data();
+  for (const auto size : sizes)
+  {
+    for_each_entry(region, region + size, [&weights, offset, divisor](uint64_t i, float value)
+        { (&weights.strided_index(i))[offset] += value / divisor; });
+    region += size;
+  }
+  return true;
+}
+
+// Lets do_weighting work on a copy of the strided weights.
+class strided_buffer
+{
+public:
+  strided_buffer(float* data, uint32_t stride_shift) : _data(data), _stride_shift(stride_shift) {}
+  float& strided_index(size_t index) { return _data[index << _stride_shift]; }
+
+private:
+  float* _data;
+  uint32_t _stride_shift;
+};
+
+bool try_sparse_all_reduce(VW::workspace& all, VW::parameters& weights, uint64_t length, size_t offset, float divisor)
+{
+  if (!all.runtime_config.sparse_all_reduce) { return false; }
+  return weights.sparse ? sparse_all_reduce(all, weights.sparse_weights, length, offset, divisor)
+                        : sparse_all_reduce(all, weights.dense_weights, length, offset, divisor);
+}
+}  // namespace
+
 void VW::details::accumulate(VW::workspace& all, parameters& weights, size_t offset)
 {
   uint64_t length = UINT64_ONE << all.initial_weights_config.num_bits;  // This is size of gradient
+  if (try_sparse_all_reduce(all, weights, length, offset, 1.f)) { return; }
   float* local_grad = new float[length];
 
   if (weights.sparse)
@@ -70,6 +211,7 @@ void VW::details::accumulate_avg(VW::workspace& all, parameters& weights, size_t
 {
   uint32_t length = 1 << all.initial_weights_config.num_bits;  // This is size of gradient
   float numnodes = static_cast<float>(all.runtime_state.all_reduce->total);
+  if (try_sparse_all_reduce(all, weights, length, offset, numnodes)) { return; }
   float* local_grad = new float[length];
 
   if (weights.sparse)
@@ -157,3 +299,84 @@ void VW::details::accumulate_weighted_avg(VW::workspace& all, parameters& weight
   }
   delete[] local_weights;
 }
+
+VW::details::async_accumulator::~async_accumulator()
+{
+  if (_thread.joinable()) { _thread.join(); }
+}
+
+void VW::details::async_accumulator::start(VW::workspace& all, parameters& weights)
+{
+  if (pending()) { THROW("An asynchronous weight average is already running") }
+  if (weights.sparse) { THROW("Asynchronous weight averaging is only supported for dense weights") }
+
+  const uint64_t length = UINT64_ONE << all.initial_weights_config.num_bits;
+  auto& dense = weights.dense_weights;
+  _adaptive = weights.adaptive;
+  _stride_shift = dense.stride_shift();
+  _normalized_idx = all.initial_weights_config.normalized_idx;
+
+  // Adaptive weights are averaged with their whole stride, like accumulate_weighted_avg does.
+  if (_adaptive) { _snapshot.assign(dense.data(), dense.data() + (length << _stride_shift)); }
+  else
+  {
+    _snapshot.resize(length);
+    for (uint64_t i = 0; i < length; i++) { _snapshot[i] = dense.strided_index(i); }
+  }
+  _average = _snapshot;
+  _error = nullptr;
+
+  _thread = std::thread(
+      [this, &all, length]()
+      {
+        try
+        {
+          average(all, length);
+        }
+        catch (...)
+        {
+          _error = std::current_exception();
+        }
+      });
+}
+
+void VW::details::async_accumulator::average(VW::workspace& all, uint64_t length)
+{
+  if (!_adaptive)
+  {
+    const float numnodes = static_cast<float>(all.runtime_state.all_reduce->total);
+    VW::details::all_reduce<float, add_float>(all, _average.data(), _average.size());
+    for (auto& value : _average) { value /= numnodes; }
+    return;
+  }
+
+  std::vector<float> local_weights(length);
+  for (uint64_t i = 0; i < length; i++) { local_weights[i] = _average[(i << _stride_shift) + 1]; }
+  VW::details::all_reduce<float, add_float>(all, local_weights.data(), length);
+  strided_buffer buffer(_average.data(), _stride_shift);
+  VW::details::do_weighting(_normalized_idx, length, local_weights.data(), buffer);
+  VW::details::all_reduce<float, add_float>(all, _average.data(), _average.size());
+}
+
+void VW::details::async_accumulator::finish(parameters& weights)
+{
+  if (!pending()) { return; }
+  _thread.join();
+  if (_error != nullptr)
+  {
+    auto error = _error;
+    _error = nullptr;
+    std::rethrow_exception(error);
+  }
+
+  auto& dense = weights.dense_weights;
+  if (_adaptive)
+  {
+    float* data = dense.data();
+    for (size_t i = 0; i < _average.size(); i++) { data[i] += _average[i] - _snapshot[i]; }
+  }
+  else
+  {
+    for (size_t i = 0; i < _average.size(); i++) { dense.strided_index(i) += _average[i] - _snapshot[i]; }
+  }
+}
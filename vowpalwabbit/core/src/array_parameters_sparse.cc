@@ -7,69 +7,355 @@
 #include "vw/common/vw_exception.h"
 #include "vw/core/memory.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
-#include <unordered_map>
+#include <mutex>
+#include <utility>
+#include <vector>
 
-VW::weight* VW::sparse_parameters::get_or_default_and_get(size_t i) const
+namespace
 {
-  uint64_t index = i & _weight_mask;
-  auto iter = _map.find(index);
-  if (iter == _map.end())
+constexpr size_t INITIAL_TABLE_SIZE = 16;
+constexpr size_t INITIAL_SLAB_BLOCKS = 64;
+constexpr size_t MAX_SLAB_BLOCKS = 1 << 16;
+
+class scratch_block
+{
+public:
+  std::vector<VW::weight> weights;
+
+  VW::weight* zeroed(size_t stride)
   {
-    // memory allocated by calloc should be freed by C free()
-    _map.insert(std::make_pair(
-        index, std::shared_ptr<VW::weight>(VW::details::calloc_mergable_or_throw<VW::weight>(stride()), free)));
-    iter = _map.find(index);
-    if (_default_func != nullptr) { _default_func(iter->second.get(), index); }
+    weights.assign(stride, 0.f);
+    return weights.data();
+  }
+};
+}  // namespace
+
+VW::weight* VW::details::sparse_shard::find(uint64_t index, uint64_t hash) const
+{
+  if (table.empty()) { return nullptr; }
+  const size_t mask = table.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+  {
+    const auto& entry = table[slot];
+    if (entry.block == nullptr) { return nullptr; }
+    if (entry.index == index) { return entry.block; }
   }
-  return iter->second.get();
 }
 
-VW::weight* VW::sparse_parameters::get_impl(size_t i) const
+VW::weight* VW::details::sparse_shard::find_or_insert(
+    uint64_t index, uint64_t hash, size_t stride, uint64_t model, bool& inserted)
 {
-  static auto default_value =
-      std::shared_ptr<VW::weight>(VW::details::calloc_mergable_or_throw<VW::weight>(stride()), free);
-  uint64_t index = i & _weight_mask;
-  auto iter = _map.find(index);
-  if (iter == _map.end())
+  // Keep the load factor below 0.7 so that probe sequences stay short.
+  if ((size + 1) * 10 > table.size() * 7) { grow(); }
+  const size_t mask = table.size() - 1;
+  size_t slot = hash & mask;
+  for (; table[slot].block != nullptr; slot = (slot + 1) & mask)
   {
-    // Add entry to map if _default_func is defined
-    if (_default_func != nullptr)
+    if (table[slot].index == index)
     {
-      // memory allocated by calloc should be freed by C free()
-      _map.insert(std::make_pair(
-          index, std::shared_ptr<VW::weight>(VW::details::calloc_mergable_or_throw<VW::weight>(stride()), free)));
-      iter = _map.find(index);
-      _default_func(iter->second.get(), index);
-      return iter->second.get();
+      inserted = false;
+      return table[slot].block;
     }
-    // Return default value if _default_func is not defined
-    return default_value.get();
   }
 
-  // Get entry if it exists in the map
-  return iter->second.get();
+  inserted = true;
+  table[slot].index = index;
+  table[slot].block = slabs_of(model).allocate(stride);
+  size++;
+  return table[slot].block;
+}
+
+void VW::details::sparse_shard::add(uint64_t index, uint64_t hash, VW::weight* block)
+{
+  if ((size + 1) * 10 > table.size() * 7) { grow(); }
+  const size_t mask = table.size() - 1;
+  size_t slot = hash & mask;
+  while (table[slot].block != nullptr) { slot = (slot + 1) & mask; }
+  table[slot].index = index;
+  table[slot].block = block;
+  size++;
+}
+
+void VW::details::sparse_shard::remove_if(const std::function<bool(uint64_t)>& matches)
+{
+  std::vector<sparse_entry> old_table(table.size());
+  old_table.swap(table);
+  size = 0;
+  for (const auto& entry : old_table)
+  {
+    if (entry.block != nullptr && !matches(entry.index)) { add(entry.index, sparse_hash(entry.index), entry.block); }
+  }
+}
+
+VW::details::sparse_slabs& VW::details::sparse_shard::slabs_of(uint64_t model)
+{
+  if (model >= models.size()) { models.resize(model + 1); }
+  return models[model];
+}
+
+VW::weight* VW::details::sparse_slabs::allocate(size_t stride)
+{
+  if (used + stride > capacity)
+  {
+    // Slabs double in size so that the number of allocations grows logarithmically with the number of weights.
+    const size_t blocks = capacity == 0
+        ? INITIAL_SLAB_BLOCKS
+        : std::min(std::max(capacity / stride, INITIAL_SLAB_BLOCKS / 2) * 2, MAX_SLAB_BLOCKS);
+    // memory allocated by calloc should be freed by C free()
+    slabs.emplace_back(VW::details::calloc_mergable_or_throw<VW::weight>(blocks * stride), free);
+    used = 0;
+    capacity = blocks * stride;
+  }
+  VW::weight* block = slabs.back().get() + used;
+  used += stride;
+  return block;
+}
+
+void VW::details::sparse_shard::grow()
+{
+  std::vector<sparse_entry> old_table(std::max(table.size() * 2, INITIAL_TABLE_SIZE));
+  old_table.swap(table);
+  size = 0;
+  for (const auto& entry : old_table)
+  {
+    if (entry.block != nullptr) { add(entry.index, sparse_hash(entry.index), entry.block); }
+  }
+}
+
+VW::weight* VW::sparse_parameters::get_or_default_and_get(size_t i)
+{
+  const uint64_t index = i & _weight_mask;
+  const uint64_t hash = details::sparse_hash(index);
+  auto& shard = shard_of(hash);
+  std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+  if (_concurrent) { lock.lock(); }
+
+  bool inserted = false;
+  auto* block = shard.find_or_insert(index, hash, stride(), model_of(index), inserted);
+  if (inserted && _default_func != nullptr) { _default_func(block, index); }
+  return block;
+}
+
+VW::weight* VW::sparse_parameters::get_impl(size_t i)
+{
+  // Add entry to the table if _default_func is defined
+  if (_default_func != nullptr) { return get_or_default_and_get(i); }
+
+  const uint64_t index = i & _weight_mask;
+  const uint64_t hash = details::sparse_hash(index);
+  auto& shard = shard_of(hash);
+  VW::weight* block = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (_concurrent) { lock.lock(); }
+    block = shard.find(index, hash);
+  }
+  // Return default value if _default_func is not defined
+  return block != nullptr ? block : default_block(index);
+}
+
+const VW::weight* VW::sparse_parameters::get_const_impl(size_t i) const
+{
+  const uint64_t index = i & _weight_mask;
+  const uint64_t hash = details::sparse_hash(index);
+  auto& shard = shard_of(hash);
+  const VW::weight* block = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (_concurrent) { lock.lock(); }
+    block = shard.find(index, hash);
+  }
+  return block != nullptr ? block : default_block(index);
+}
+
+VW::weight* VW::sparse_parameters::default_block(uint64_t index) const
+{
+  static thread_local scratch_block scratch;
+  auto* block = scratch.zeroed(stride());
+  if (_default_func != nullptr) { _default_func(block, index); }
+  return block;
 }
 
 VW::sparse_parameters::sparse_parameters(size_t length, uint32_t stride_shift)
-    : _weight_mask((length << stride_shift) - 1), _stride_shift(stride_shift), _default_func(nullptr)
+    : _shards(std::make_shared<std::vector<details::sparse_shard>>(1))
+    , _weight_mask((length << stride_shift) - 1)
+    , _stride_shift(stride_shift)
+    , _default_func(nullptr)
 {
 }
 
-VW::sparse_parameters::sparse_parameters() : _weight_mask(0), _stride_shift(0), _default_func(nullptr) {}
+VW::sparse_parameters::sparse_parameters()
+    : _shards(std::make_shared<std::vector<details::sparse_shard>>(1))
+    , _weight_mask(0)
+    , _stride_shift(0)
+    , _default_func(nullptr)
+{
+}
 
 void VW::sparse_parameters::shallow_copy(const sparse_parameters& input)
 {
-  // Note: level-1 shallow copy. VW::weight* are intentionally shared.
-  _map = input._map;
+  if (input._concurrent)
+  {
+    _shards = input._shards;
+    _default_func = input._default_func;
+  }
+  else
+  {
+    // Note: level-1 shallow copy. VW::weight* are intentionally shared.
+    auto shards = std::make_shared<std::vector<details::sparse_shard>>(input._shards->size());
+    for (size_t k = 0; k < shards->size(); k++)
+    {
+      auto& shard = (*shards)[k];
+      const auto& source = (*input._shards)[k];
+      shard.table = source.table;
+      shard.size = source.size;
+      // The slabs are kept alive, but the remainder of the last one belongs to input.
+      shard.models.resize(source.models.size());
+      for (size_t model = 0; model < source.models.size(); model++)
+      {
+        shard.models[model].slabs = source.models[model].slabs;
+      }
+    }
+    _shards = std::move(shards);
+  }
+  _shard_bits = input._shard_bits;
+  _concurrent = input._concurrent;
   _weight_mask = input._weight_mask;
   _stride_shift = input._stride_shift;
+  _model_mask = input._model_mask;
+}
+
+void VW::sparse_parameters::enable_concurrent_inserts(size_t num_shards)
+{
+  if (num_shards == 0 || (num_shards & (num_shards - 1)) != 0)
+  {
+    THROW_OR_RETURN("The number of sparse weight shards must be a power of 2, got " << num_shards);
+  }
+  if (_concurrent) { THROW_OR_RETURN("Concurrent inserts are already enabled for these sparse weights"); }
+
+  uint32_t shard_bits = 0;
+  while ((static_cast<size_t>(1) << shard_bits) < num_shards) { shard_bits++; }
+
+  // Blocks stay where they are, only the entries move to their new shard. The first shard keeps the old slabs alive.
+  auto shards = std::make_shared<std::vector<details::sparse_shard>>(num_shards);
+  for (auto& old_shard : *_shards)
+  {
+    for (const auto& entry : old_shard.table)
+    {
+      if (entry.block == nullptr) { continue; }
+      const uint64_t hash = details::sparse_hash(entry.index);
+      (*shards)[shard_bits == 0 ? 0 : hash >> (64 - shard_bits)].add(entry.index, hash, entry.block);
+    }
+    for (size_t model = 0; model < old_shard.models.size(); model++)
+    {
+      auto& kept = shards->front().slabs_of(model).slabs;
+      kept.insert(kept.end(), old_shard.models[model].slabs.begin(), old_shard.models[model].slabs.end());
+    }
+  }
+  _shards = std::move(shards);
+  _shard_bits = shard_bits;
+  _concurrent = true;
+}
+
+void VW::sparse_parameters::set_model_width(uint64_t width)
+{
+  if (width == 0 || (width & (width - 1)) != 0)
+  {
+    THROW_OR_RETURN("The number of models in sparse weights must be a power of 2, got " << width);
+  }
+  if (width == model_width()) { return; }
+  if (size() != 0) { THROW_OR_RETURN("The number of models in sparse weights cannot change once there are weights"); }
+  _model_mask = width - 1;
+}
+
+bool VW::sparse_parameters::check_model(uint64_t model) const
+{
+  if (model > _model_mask)
+  {
+    THROW_OR_RETURN("Model " << model << " is out of range for sparse weights with " << model_width() << " models",
+        false);
+  }
+  return true;
+}
+
+void VW::sparse_parameters::copy_model(uint64_t from, uint64_t to)
+{
+  if (!check_model(from) || !check_model(to) || from == to) { return; }
+  release_model(to);
+
+  std::vector<details::sparse_entry> sources;
+  for (const auto& shard : *_shards)
+  {
+    for (const auto& entry : shard.table)
+    {
+      if (entry.block != nullptr && model_of(entry.index) == from) { sources.push_back(entry); }
+    }
+  }
+  for (const auto& source : sources)
+  {
+    const uint64_t index = with_model(source.index, to);
+    const uint64_t hash = details::sparse_hash(index);
+    bool inserted = false;
+    auto* block = shard_of(hash).find_or_insert(index, hash, stride(), to, inserted);
+    std::copy(source.block, source.block + stride(), block);
+  }
+}
+
+void VW::sparse_parameters::swap_models(uint64_t a, uint64_t b)
+{
+  if (!check_model(a) || !check_model(b) || a == b) { return; }
+
+  // The blocks stay where they are and so do the slabs, which only need to be relabeled to keep holding the blocks of a
+  // single model each. The entries move to their new indices, which are usually in another shard.
+  auto matches = [this, a, b](uint64_t index) { return model_of(index) == a || model_of(index) == b; };
+  std::vector<details::sparse_entry> moved;
+  for (auto& shard : *_shards)
+  {
+    for (const auto& entry : shard.table)
+    {
+      if (entry.block != nullptr && matches(entry.index)) { moved.push_back(entry); }
+    }
+    shard.remove_if(matches);
+    shard.slabs_of(std::max(a, b));
+    std::swap(shard.models[a], shard.models[b]);
+  }
+  for (const auto& entry : moved)
+  {
+    const uint64_t index = with_model(entry.index, model_of(entry.index) == a ? b : a);
+    const uint64_t hash = details::sparse_hash(index);
+    shard_of(hash).add(index, hash, entry.block);
+  }
+}
+
+void VW::sparse_parameters::release_model(uint64_t model)
+{
+  if (!check_model(model)) { return; }
+  for (auto& shard : *_shards)
+  {
+    shard.remove_if([this, model](uint64_t index) { return model_of(index) == model; });
+    shard.slabs_of(model) = details::sparse_slabs();
+  }
+}
+
+size_t VW::sparse_parameters::size() const
+{
+  size_t size = 0;
+  for (const auto& shard : *_shards) { size += shard.size; }
+  return size;
 }
 
 void VW::sparse_parameters::set_zero(size_t offset)
 {
-  for (auto& iter : _map) { (&(*(iter.second)))[offset] = 0; }
+  for (auto& shard : *_shards)
+  {
+    for (auto& entry : shard.table)
+    {
+      if (entry.block != nullptr) { entry.block[offset] = 0; }
+    }
+  }
 }
 #ifndef _WIN32
 void VW::sparse_parameters::share(size_t /* length */) { THROW_OR_RETURN("Operation not supported on Windows"); }
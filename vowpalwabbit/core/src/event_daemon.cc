@@ -0,0 +1,564 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/event_daemon.h"
+
+#include "vw/common/vw_exception.h"
+
+#if defined(VW_FEAT_NETWORKING_ENABLED) && defined(__linux__)
+
+#  include "vw/core/global_data.h"
+#  include "vw/core/learner.h"
+#  include "vw/core/parse_regressor.h"
+#  include "vw/core/parser.h"
+#  include "vw/core/vw.h"
+#  include "vw/io/errno_handling.h"
+#  include "vw/io/io_adapter.h"
+#  include "vw/text_parser/parse_example_text.h"
+
+#  include <fcntl.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+#  include <algorithm>
+#  include <atomic>
+#  include <csignal>
+#  include <cstring>
+#  include <exception>
+#  include <string>
+#  include <unordered_map>
+#  include <vector>
+
+namespace
+{
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+constexpr int MAX_EVENTS = 256;
+// Reading from a connection pauses once this many received bytes are waiting to be parsed, which also bounds the
+// length of a single line.
+constexpr size_t MAX_BUFFERED_INPUT = 4 * 1024 * 1024;
+
+volatile sig_atomic_t got_sigterm = 0;
+std::atomic<int> sigterm_wake_fd{-1};
+
+void handle_sigterm(int)
+{
+  got_sigterm = 1;
+  const int fd = sigterm_wake_fd.load();
+  if (fd >= 0)
+  {
+    const uint64_t one = 1;
+    auto written = ::write(fd, &one, sizeof(one));
+    (void)written;
+  }
+}
+
+// Final prediction sink which appends to the output buffer of the connection whose example is being finished.
+class routed_writer : public VW::io::writer
+{
+public:
+  ssize_t write(const char* buffer, size_t num_bytes) override
+  {
+    if (target != nullptr) { target->append(buffer, num_bytes); }
+    return static_cast<ssize_t>(num_bytes);
+  }
+
+  std::string* target = nullptr;
+};
+
+class connection
+{
+public:
+  explicit connection(int fd) : fd(fd) {}
+  ~connection() { ::close(fd); }
+  connection(const connection&) = delete;
+  connection& operator=(const connection&) = delete;
+
+  int fd;
+  std::string input;  // Bytes received but not parsed yet, starting at input_pos.
+  size_t input_pos = 0;
+  std::string output;  // Predictions not sent yet, starting at output_pos.
+  size_t output_pos = 0;
+  VW::multi_ex pending;  // Lines of a multiline example whose terminating empty line has not arrived yet.
+  bool read_closed = false;
+  bool reading_paused = false;
+  bool broken = false;
+  bool waiting_for_write = false;
+};
+
+class batch_item
+{
+public:
+  connection* conn;
+  VW::multi_ex examples;
+};
+
+bool is_save_cmd(const VW::example& ec)
+{
+  return ec.tag.size() >= 4 && std::strncmp(ec.tag.begin(), "save", 4) == 0;
+}
+}  // namespace
+
+class VW::details::event_daemon::impl
+{
+public:
+  impl(VW::workspace& all, int listen_fd, size_t max_batch_size)
+      : _all(all), _listen_fd(listen_fd), _max_batch_size(std::max<size_t>(max_batch_size, 1))
+  {
+    // The listen backlog set up for forked children is too short for many short lived connections.
+    if (::listen(_listen_fd, SOMAXCONN) < 0) { THROWERRNO("listen"); }
+    const int flags = ::fcntl(_listen_fd, F_GETFL, 0);
+    if (flags < 0 || ::fcntl(_listen_fd, F_SETFL, flags | O_NONBLOCK) < 0) { THROWERRNO("fcntl"); }
+
+    _epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (_epoll_fd < 0) { THROWERRNO("epoll_create1"); }
+    _wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_wake_fd < 0)
+    {
+      ::close(_epoll_fd);
+      THROWERRNO("eventfd");
+    }
+    watch(_listen_fd, EPOLLIN, EPOLL_CTL_ADD);
+    watch(_wake_fd, EPOLLIN, EPOLL_CTL_ADD);
+
+    auto writer = VW::make_unique<routed_writer>();
+    _writer = writer.get();
+    _all.output_runtime.final_prediction_sink.push_back(std::move(writer));
+  }
+
+  ~impl()
+  {
+    for (auto& entry : _connections) { release_pending(*entry.second); }
+    _connections.clear();
+
+    auto& sinks = _all.output_runtime.final_prediction_sink;
+    sinks.erase(std::remove_if(sinks.begin(), sinks.end(),
+                    [this](const std::unique_ptr<VW::io::writer>& sink) { return sink.get() == _writer; }),
+        sinks.end());
+    ::close(_wake_fd);
+    ::close(_epoll_fd);
+  }
+
+  void run()
+  {
+    sigterm_wake_fd = _wake_fd;
+    std::vector<epoll_event> events(MAX_EVENTS);
+    while (!_stop && got_sigterm == 0)
+    {
+      // Lines left over from a full batch are served before blocking again.
+      const int timeout = _has_backlog ? 0 : -1;
+      const int num_events = ::epoll_wait(_epoll_fd, events.data(), MAX_EVENTS, timeout);
+      if (num_events < 0)
+      {
+        if (errno == EINTR) { continue; }
+        sigterm_wake_fd = -1;
+        THROWERRNO("epoll_wait");
+      }
+
+      for (int i = 0; i < num_events; ++i)
+      {
+        const int fd = events[i].data.fd;
+        if (fd == _listen_fd) { accept_connections(); }
+        else if (fd == _wake_fd)
+        {
+          uint64_t count = 0;
+          auto num_read = ::read(_wake_fd, &count, sizeof(count));
+          (void)num_read;
+        }
+        else
+        {
+          auto it = _connections.find(fd);
+          if (it == _connections.end()) { continue; }
+          if ((events[i].events & EPOLLOUT) != 0) { flush(*it->second); }
+          if ((events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0) { receive(*it->second); }
+        }
+      }
+
+      fill_batch();
+      process_batch();
+      close_finished_connections();
+    }
+    sigterm_wake_fd = -1;
+  }
+
+  void stop()
+  {
+    _stop = true;
+    const uint64_t one = 1;
+    auto written = ::write(_wake_fd, &one, sizeof(one));
+    (void)written;
+  }
+
+  std::atomic<size_t> num_connections{0};
+
+private:
+  void watch(int fd, uint32_t events, int op)
+  {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (::epoll_ctl(_epoll_fd, op, fd, &event) < 0) { THROWERRNO("epoll_ctl"); }
+  }
+
+  void update_watch(const connection& conn)
+  {
+    uint32_t events = (conn.read_closed || conn.reading_paused) ? 0 : (EPOLLIN | EPOLLRDHUP);
+    if (conn.waiting_for_write) { events |= EPOLLOUT; }
+    watch(conn.fd, events, EPOLL_CTL_MOD);
+  }
+
+  void accept_connections()
+  {
+    while (true)
+    {
+      const int fd = ::accept4(_listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd < 0)
+      {
+        if (errno == EINTR) { continue; }
+        // EAGAIN means the backlog is drained, anything else only concerns the connection being accepted.
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNABORTED)
+        {
+          _all.logger.err_warn("accept: {}", VW::io::strerror_to_string(errno));
+        }
+        return;
+      }
+
+      // Disable Nagle delay algorithm due to daemon mode's interactive workload
+      int one = 1;
+      ::setsockopt(fd, SOL_TCP, TCP_NODELAY, reinterpret_cast<char*>(&one), sizeof(one));
+
+      _connections.emplace(fd, VW::make_unique<connection>(fd));
+      watch(fd, EPOLLIN | EPOLLRDHUP, EPOLL_CTL_ADD);
+      ++num_connections;
+    }
+  }
+
+  void receive(connection& conn)
+  {
+    char buffer[READ_CHUNK_SIZE];
+    while (!conn.read_closed && !conn.reading_paused)
+    {
+      const ssize_t num_read = ::recv(conn.fd, buffer, sizeof(buffer), 0);
+      if (num_read > 0)
+      {
+        conn.input.append(buffer, static_cast<size_t>(num_read));
+        // Leave the rest in the socket until fill_batch has consumed what is buffered.
+        if (conn.input.size() - conn.input_pos >= MAX_BUFFERED_INPUT)
+        {
+          conn.reading_paused = true;
+          update_watch(conn);
+        }
+      }
+      else if (num_read == 0)
+      {
+        conn.read_closed = true;
+        // A closed read side stays readable, so stop polling for it to avoid spinning while output is pending.
+        update_watch(conn);
+      }
+      else if (errno == EINTR) { continue; }
+      else
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) { conn.broken = true; }
+        return;
+      }
+    }
+  }
+
+  void flush(connection& conn)
+  {
+    while (conn.output_pos < conn.output.size())
+    {
+      const ssize_t num_sent = ::send(conn.fd, conn.output.data() + conn.output_pos,
+          conn.output.size() - conn.output_pos, MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (num_sent >= 0) { conn.output_pos += static_cast<size_t>(num_sent); }
+      else if (errno == EINTR) { continue; }
+      else if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        if (!conn.waiting_for_write)
+        {
+          conn.waiting_for_write = true;
+          update_watch(conn);
+        }
+        return;
+      }
+      else
+      {
+        conn.broken = true;
+        return;
+      }
+    }
+
+    conn.output.clear();
+    conn.output_pos = 0;
+    if (conn.waiting_for_write)
+    {
+      conn.waiting_for_write = false;
+      update_watch(conn);
+    }
+  }
+
+  // Returns the next complete line of conn, or false if none has been received yet. The last line of a connection
+  // does not need a trailing newline.
+  bool next_line(connection& conn, VW::string_view& line)
+  {
+    if (conn.input_pos >= conn.input.size()) { return false; }
+    const size_t newline = conn.input.find('\n', conn.input_pos);
+    if (newline == std::string::npos && conn.reading_paused)
+    {
+      THROW("line is longer than the " << MAX_BUFFERED_INPUT << " bytes buffered per connection");
+    }
+    if (newline == std::string::npos && !conn.read_closed) { return false; }
+
+    const size_t end = newline == std::string::npos ? conn.input.size() : newline;
+    line = VW::string_view(conn.input.data() + conn.input_pos, end - conn.input_pos);
+    if (!line.empty() && line.back() == '\r') { line.remove_suffix(1); }
+    conn.input_pos = newline == std::string::npos ? conn.input.size() : newline + 1;
+    return true;
+  }
+
+  // Parses lines of conn until one example (or one multiline example) is complete.
+  bool next_unit(connection& conn, VW::multi_ex& unit)
+  {
+    const bool multiline = _all.l->is_multiline();
+    VW::string_view line;
+    while (next_line(conn, line))
+    {
+      if (multiline && line.empty())
+      {
+        if (conn.pending.empty()) { continue; }
+        unit.swap(conn.pending);
+        return true;
+      }
+
+      // The example is pending while it is parsed, so it goes back to the pool with the connection if parsing throws.
+      VW::example* ec = &VW::get_unused_example(&_all);
+      conn.pending.push_back(ec);
+      VW::parsers::text::read_line(_all, ec, line);
+      VW::setup_example(_all, ec);
+      if (!multiline)
+      {
+        unit.swap(conn.pending);
+        return true;
+      }
+    }
+
+    // A multiline example at the end of the stream is complete even without the empty line.
+    if (multiline && conn.read_closed && conn.input_pos >= conn.input.size() && !conn.pending.empty())
+    {
+      unit.swap(conn.pending);
+      return true;
+    }
+    return false;
+  }
+
+  void fill_batch()
+  {
+    // Take one example from each connection in turn so a single busy client cannot starve the others.
+    _batch.clear();
+    _has_backlog = false;
+    bool progress = true;
+    while (progress && _batch.size() < _max_batch_size)
+    {
+      progress = false;
+      for (auto& entry : _connections)
+      {
+        auto& conn = *entry.second;
+        if (conn.broken) { continue; }
+        batch_item item{&conn, {}};
+        try
+        {
+          if (!next_unit(conn, item.examples)) { continue; }
+        }
+        catch (const std::exception& e)
+        {
+          drop(conn, e);
+          continue;
+        }
+        _batch.push_back(std::move(item));
+        progress = true;
+        if (_batch.size() == _max_batch_size)
+        {
+          _has_backlog = true;
+          break;
+        }
+      }
+    }
+
+    for (auto& entry : _connections)
+    {
+      auto& conn = *entry.second;
+      if (conn.input_pos > 0 && conn.input_pos * 2 >= conn.input.size())
+      {
+        conn.input.erase(0, conn.input_pos);
+        conn.input_pos = 0;
+      }
+      if (conn.reading_paused && !conn.broken && conn.input.size() - conn.input_pos < MAX_BUFFERED_INPUT)
+      {
+        conn.reading_paused = false;
+        update_watch(conn);
+      }
+    }
+  }
+
+  void process_batch()
+  {
+    for (auto& item : _batch)
+    {
+      // Examples queued before their connection failed are not learned from.
+      if (item.conn->broken)
+      {
+        VW::finish_example(_all, item.examples);
+        continue;
+      }
+
+      _writer->target = &item.conn->output;
+      try
+      {
+        learn(item.examples);
+      }
+      catch (const std::exception& e)
+      {
+        VW::finish_example(_all, item.examples);
+        drop(*item.conn, e);
+      }
+      _writer->target = nullptr;
+    }
+
+    for (auto& item : _batch)
+    {
+      if (!item.conn->broken && item.conn->output_pos < item.conn->output.size()) { flush(*item.conn); }
+    }
+    _batch.clear();
+  }
+
+  void learn(VW::multi_ex& examples)
+  {
+    if (_all.l->is_multiline())
+    {
+      _all.learn(examples);
+      VW::LEARNER::require_multiline(_all.l)->finish_example(_all, examples);
+    }
+    else
+    {
+      auto& ec = *examples[0];
+      if (is_save_cmd(ec)) { save(ec); }
+      else
+      {
+        _all.learn(ec);
+        VW::LEARNER::require_singleline(_all.l)->finish_example(_all, ec);
+      }
+    }
+  }
+
+  // A client sending an example that cannot be parsed or learned from only loses its own connection.
+  void drop(connection& conn, const std::exception& e)
+  {
+    _all.logger.err_error("closing daemon connection: {}", e.what());
+    conn.broken = true;
+  }
+
+  void save(VW::example& ec)
+  {
+    std::string final_regressor_name = _all.output_model_config.final_regressor_name;
+    if (ec.tag.size() >= 6 && ec.tag[4] == '_')
+    {
+      final_regressor_name = std::string(ec.tag.begin() + 5, ec.tag.size() - 5);
+    }
+    if (!_all.output_config.quiet)
+    {
+      *(_all.output_runtime.trace_message) << "saving regressor to " << final_regressor_name << std::endl;
+    }
+    VW::details::save_predictor(_all, final_regressor_name, 0);
+    VW::finish_example(_all, ec);
+  }
+
+  void release_pending(connection& conn)
+  {
+    for (auto* ec : conn.pending) { VW::finish_example(_all, *ec); }
+    conn.pending.clear();
+  }
+
+  void close_finished_connections()
+  {
+    for (auto it = _connections.begin(); it != _connections.end();)
+    {
+      auto& conn = *it->second;
+      const bool drained = conn.read_closed && conn.input_pos >= conn.input.size() && conn.pending.empty() &&
+          conn.output_pos >= conn.output.size();
+      if (conn.broken || drained)
+      {
+        release_pending(conn);
+        // Closing the descriptor removes it from the epoll set.
+        it = _connections.erase(it);
+        --num_connections;
+      }
+      else { ++it; }
+    }
+  }
+
+  VW::workspace& _all;
+  int _listen_fd;
+  size_t _max_batch_size;
+  int _epoll_fd = -1;
+  int _wake_fd = -1;
+  std::atomic<bool> _stop{false};
+  bool _has_backlog = false;
+  routed_writer* _writer = nullptr;  // Owned by final_prediction_sink.
+  std::unordered_map<int, std::unique_ptr<connection>> _connections;
+  std::vector<batch_item> _batch;
+};
+
+VW::details::event_daemon::event_daemon(VW::workspace& all, int listen_fd, size_t max_batch_size)
+    : _impl(VW::make_unique<impl>(all, listen_fd, max_batch_size))
+{
+}
+
+VW::details::event_daemon::~event_daemon() = default;
+
+void VW::details::event_daemon::run() { _impl->run(); }
+
+void VW::details::event_daemon::stop() { _impl->stop(); }
+
+size_t VW::details::event_daemon::num_connections() const { return _impl->num_connections; }
+
+void VW::details::run_event_daemon(VW::workspace& all)
+{
+  struct sigaction sa;
+  std::memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = handle_sigterm;
+  sigaction(SIGTERM, &sa, nullptr);
+
+  event_daemon daemon(all, all.parser_runtime.example_parser->bound_sock, all.runtime_config.daemon_batch_size);
+  daemon.run();
+  all.l->end_examples();
+}
+
+#else
+
+class VW::details::event_daemon::impl
+{
+};
+
+VW::details::event_daemon::event_daemon(VW::workspace&, int, size_t)
+{
+  THROW("--daemon_event_loop is only supported on Linux builds with networking enabled");
+}
+
+VW::details::event_daemon::~event_daemon() = default;
+
+void VW::details::event_daemon::run() {}
+
+void VW::details::event_daemon::stop() {}
+
+size_t VW::details::event_daemon::num_connections() const { return 0; }
+
+void VW::details::run_event_daemon(VW::workspace&)
+{
+  THROW("--daemon_event_loop is only supported on Linux builds with networking enabled");
+}
+
+#endif
@@ -201,6 +201,8 @@ void truncate_example_namespace(VW::example& ec, VW::namespace_index ns, const f
   ec.reset_total_sum_feat_sq();
   ec.num_features -= fs.size();
   del_target.truncate_to(del_target.size() - fs.size(), fs.sum_feat_sq);
+  // Features appended and removed again, e.g. by ccb for every slot, can leave each namespace with its former size.
+  ec.interaction_expansions.invalidate();
 }
 
 void append_example_namespace(VW::example& ec, VW::namespace_index ns, const features& fs)
@@ -213,6 +215,7 @@ void append_example_namespace(VW::example& ec, VW::namespace_index ns, const fea
   add_fs.concat(fs);
   ec.reset_total_sum_feat_sq();
   ec.num_features += fs.size();
+  ec.interaction_expansions.invalidate();
 }
 
 void append_example_namespaces_from_example(VW::example& target, const VW::example& source)
@@ -20,6 +20,15 @@ void VW::features::clear()
   namespace_extents.clear();
 }
 
+void VW::features::clear_noshrink()
+{
+  sum_feat_sq = 0.f;
+  values.clear_noshrink();
+  indices.clear_noshrink();
+  space_names.clear();
+  namespace_extents.clear();
+}
+
 void VW::features::truncate_to(const audit_iterator& pos, float sum_feat_sq_of_removed_section)
 {
   truncate_to(std::distance(audit_begin(), pos), sum_feat_sq_of_removed_section);
@@ -113,6 +122,13 @@ void VW::features::push_back(feature_value v, feature_index i)
   sum_feat_sq += v * v;
 }
 
+void VW::features::append(const feature_value* v, const feature_index* i, size_t count)
+{
+  values.insert(values.end(), v, v + count);
+  indices.insert(indices.end(), i, i + count);
+  for (size_t k = 0; k < count; ++k) { sum_feat_sq += v[k] * v[k]; }
+}
+
 void VW::features::push_back(feature_value v, feature_index i, uint64_t hash)
 {
   // If there is an open extent but of a different hash - we must close it before we do anything.
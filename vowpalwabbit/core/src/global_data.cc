@@ -140,6 +140,14 @@ void workspace::predict(multi_ex& ec)
   VW::LEARNER::require_multiline(l)->predict(ec);
 }
 
+void workspace::predict_batch(example* const* examples, size_t count)
+{
+  if (l->is_multiline()) THROW("This learner does not support single-line examples.");
+
+  for (size_t k = 0; k < count; k++) { examples[k]->test_only = true; }
+  VW::LEARNER::require_singleline(l)->predict_batch(examples, count);
+}
+
 void workspace::finish_example(example& ec)
 {
   if (l->is_multiline()) THROW("This learner does not support single-line examples.");
@@ -174,11 +174,28 @@ void VW::io_buf::flush()
   {
     auto bytes_written = _output_files[0]->write(_buffer.begin, unflushed_bytes_count());
     if (bytes_written != static_cast<ssize_t>(unflushed_bytes_count())) { THROW("Failed to write example"); }
+    _flushed_bytes += static_cast<size_t>(bytes_written);
     _head = _buffer.begin;
     _output_files[0]->flush();
   }
 }
 
+std::shared_ptr<char> VW::io_buf::map_copy_on_write(size_t len)
+{
+  if (_input_files.size() != 1 || _current != 0 || _verify_hash) { return nullptr; }
+
+  // Everything between the head and the end of the buffer was read ahead from the file but not consumed yet.
+  const auto buffered = static_cast<size_t>(_buffer.end - _head);
+  auto mapped = _input_files[0]->map_copy_on_write(buffered, len);
+  if (mapped != nullptr)
+  {
+    // The reader now points past the mapped region so the read ahead bytes are stale.
+    _buffer.end = _buffer.begin;
+    _head = _buffer.begin;
+  }
+  return mapped;
+}
+
 void VW::io_buf::reset()
 {
   // This operation is only intended for read buffers.
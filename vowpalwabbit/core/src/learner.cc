@@ -19,12 +19,22 @@
 
 #include "vw/core/vw_string_view_fmt.h"
 
+#include "vw/core/best_constant.h"
 #include "vw/core/parse_dispatch_loop.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 namespace VW
 {
 namespace LEARNER
@@ -129,6 +139,285 @@ private:
   std::vector<VW::workspace*> _all;
 };
 
+VW::reductions::gd* find_gd(VW::workspace& all)
+{
+  for (auto* l = all.l.get(); l != nullptr; l = l->get_base_learner())
+  {
+    if (l->get_name() == "gd")
+    {
+      return static_cast<VW::reductions::gd*>(l->get_internal_type_erased_data_pointer_test_use_only());
+    }
+  }
+  return nullptr;
+}
+
+// hogwild_learners - runs learn for single line examples on several threads at once (Hogwild). Every thread learns with
+// a replica of the master instance that has its own reduction stack and shared data but references the master's
+// weights, so updates race on the weights without any locking. Only inserting new sparse weights takes a lock. Examples
+// are finished by the driver thread in completion order, which makes it the only thread to use the master.
+class hogwild_learners
+{
+public:
+  hogwild_learners(VW::workspace& master, size_t num_threads)
+      : _master(master), _max_in_flight(std::max<size_t>(master.parser_runtime.example_parser->example_queue_limit, 1))
+  {
+    // The replicas share the master's table of sparse weights, so that a weight inserted by one thread is learned by
+    // all of them. Enough shards are used that threads rarely wait for each other's inserts.
+    if (master.weights.sparse)
+    {
+      size_t num_shards = 1;
+      while (num_shards < 16 * num_threads) { num_shards *= 2; }
+      master.weights.sparse_weights.enable_concurrent_inserts(num_shards);
+    }
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+      _replicas.push_back(VW::details::create_replica(master));
+      _replicas.back()->sd = std::make_shared<VW::shared_data>(*master.sd);
+    }
+    _gds.push_back(find_gd(master));
+    if (_gds[0] != nullptr)
+    {
+      // The replicas start from the state of the master, which may have been loaded from a model.
+      for (auto& replica : _replicas)
+      {
+        _gds.push_back(find_gd(*replica));
+        _gds.back()->gd_per_model_states = _gds[0]->gd_per_model_states;
+      }
+      _synced_states = _gds[0]->gd_per_model_states;
+    }
+    for (auto& replica : _replicas) { _threads.emplace_back(&hogwild_learners::worker_loop, this, replica.get()); }
+  }
+
+  ~hogwild_learners()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _has_work.notify_all();
+    for (auto& thread : _threads) { thread.join(); }
+  }
+
+  hogwild_learners(const hogwild_learners&) = delete;
+  hogwild_learners& operator=(const hogwild_learners&) = delete;
+
+  VW::workspace& get_master() const { return _master; }
+
+  void submit(example& ec)
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _is_done.wait(lock, [this] { return _in_flight < _max_in_flight || !_completed.empty(); });
+        if (_in_flight < _max_in_flight)
+        {
+          // gd decays its learning rate with the number of examples, which the driver counts as it finishes them.
+          _pending.push_back({&ec, _master.sd->t, _master.sd->weighted_holdout_examples,
+              _master.sd->weighted_unlabeled_examples});
+          _in_flight++;
+          break;
+        }
+      }
+      finish_completed(false);
+    }
+    _has_work.notify_one();
+    finish_completed(false);
+  }
+
+  // Waits for every submitted example to be learned and finished. Anything which is not a plain learn call is run
+  // after this so that passes and saved models see a consistent set of updates.
+  void wait_all()
+  {
+    finish_completed(true);
+    merge_gd_states();
+    merge_observed_labels();
+  }
+
+  // Brings the per instance state that the master updates outside of learn, such as the learning rate decay at the end
+  // of a pass and the shared data, over to the replicas.
+  void sync_replicas()
+  {
+    for (auto& replica : _replicas)
+    {
+      replica->update_rule_config.eta = _master.update_rule_config.eta;
+      replica->passes_config.current_pass = _master.passes_config.current_pass;
+      *replica->sd = *_master.sd;
+    }
+  }
+
+private:
+  // gd adds the norm and weight of every example it learns to the state of its model, which each thread does in its own
+  // copy. The additions made by all threads since the last merge are summed into the master and shared again.
+  void merge_gd_states()
+  {
+    if (_gds[0] == nullptr) { return; }
+    auto& master_states = _gds[0]->gd_per_model_states;
+    for (size_t thread = 1; thread < _gds.size(); ++thread)
+    {
+      const auto& states = _gds[thread]->gd_per_model_states;
+      for (size_t i = 0; i < master_states.size(); ++i)
+      {
+        master_states[i].normalized_sum_norm_x +=
+            states[i].normalized_sum_norm_x - _synced_states[i].normalized_sum_norm_x;
+        master_states[i].total_weight += states[i].total_weight - _synced_states[i].total_weight;
+      }
+    }
+    for (size_t thread = 1; thread < _gds.size(); ++thread) { _gds[thread]->gd_per_model_states = master_states; }
+    _synced_states = master_states;
+  }
+
+  // count_label and the scorer record the labels learned by each thread in the shared data of its replica. They are
+  // added to the labels observed by the master, whose shared data is shared again by sync_replicas().
+  void merge_observed_labels()
+  {
+    auto& master_sd = *_master.sd;
+    for (const auto& replica : _replicas)
+    {
+      const auto& sd = *replica->sd;
+      master_sd.min_label = std::min(master_sd.min_label, sd.min_label);
+      master_sd.max_label = std::max(master_sd.max_label, sd.max_label);
+      VW::count_label(master_sd, sd.first_observed_label);
+      VW::count_label(master_sd, sd.second_observed_label);
+      if (sd.is_more_than_two_labels_observed) { master_sd.is_more_than_two_labels_observed = true; }
+    }
+  }
+
+  void worker_loop(VW::workspace* all)
+  {
+    while (true)
+    {
+      pending_example pending;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _has_work.wait(lock, [this] { return _stop || !_pending.empty(); });
+        if (_pending.empty()) { return; }
+        pending = _pending.front();
+        _pending.pop_front();
+      }
+
+      example* ec = pending.ec;
+      all->sd->t = pending.t;
+      all->sd->weighted_holdout_examples = pending.weighted_holdout_examples;
+      all->sd->weighted_unlabeled_examples = pending.weighted_unlabeled_examples;
+      try
+      {
+        all->learn(*ec);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_error) { _error = std::current_exception(); }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _completed.push_back(ec);
+      }
+      _is_done.notify_all();
+    }
+  }
+
+  void finish_completed(bool wait_for_all)
+  {
+    std::vector<example*> completed;
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (wait_for_all) { _is_done.wait(lock, [this] { return _in_flight == _completed.size(); }); }
+      completed.assign(_completed.begin(), _completed.end());
+      _completed.clear();
+      _in_flight -= completed.size();
+      error = std::exchange(_error, nullptr);
+    }
+
+    for (auto* ec : completed) { require_singleline(_master.l)->finish_example(_master, *ec); }
+    if (error) { std::rethrow_exception(error); }
+  }
+
+  // An example waiting to be learned along with the master's example counts when it was submitted.
+  struct pending_example
+  {
+    example* ec = nullptr;
+    double t = 0.0;
+    double weighted_holdout_examples = 0.0;
+    double weighted_unlabeled_examples = 0.0;
+  };
+
+  VW::workspace& _master;
+  size_t _max_in_flight;
+  std::vector<std::unique_ptr<VW::workspace>> _replicas;
+  std::vector<std::thread> _threads;
+  std::vector<VW::reductions::gd*> _gds;  // The master's gd followed by that of each thread, if there is one.
+  std::vector<VW::reductions::details::gd_per_model_state> _synced_states;  // The state of every gd after a merge.
+
+  std::mutex _mutex;
+  std::condition_variable _has_work;
+  std::condition_variable _is_done;
+  std::deque<pending_example> _pending;
+  std::deque<example*> _completed;
+  size_t _in_flight = 0;
+  bool _stop = false;
+  std::exception_ptr _error;
+};
+
+class hogwild_context
+{
+public:
+  hogwild_context(hogwild_learners& learners) : _learners(learners) {}
+
+  VW::workspace& get_master() const { return _learners.get_master(); }
+
+  template <class T, void (*process_impl)(T&, VW::workspace&)>
+  void process(T& ec)
+  {
+    _learners.wait_all();
+    process_impl(ec, get_master());
+    _learners.sync_replicas();
+  }
+
+private:
+  hogwild_learners& _learners;
+};
+
+template <>
+void hogwild_context::process<example, learn_ex>(example& ec)
+{
+  _learners.submit(ec);
+}
+
+// Returns why the learner stack of all cannot be trained with Hogwild, or an empty string if it can. Only stacks that
+// keep their learn time state in the weights and shared data are supported.
+std::string hogwild_unsupported_reason(VW::workspace& all)
+{
+  if (all.l->is_multiline()) { return "multiline learners are not supported"; }
+  if (all.weights.sparse &&
+      (all.initial_weights_config.random_weights || all.initial_weights_config.random_positive_weights ||
+          all.initial_weights_config.normal_weights || all.initial_weights_config.tnormal_weights))
+  {
+    return "--sparse_weights with random initial weights is not supported";
+  }
+  if (all.loss_config.l1_lambda != 0.f || all.loss_config.l2_lambda != 0.f)
+  {
+    return "--l1 and --l2 are not supported";
+  }
+  if (all.runtime_state.all_reduce != nullptr) { return "cluster parallel learning is not supported"; }
+#ifdef VW_FEAT_NETWORKING_ENABLED
+  if (all.runtime_config.daemon) { return "daemon mode is not supported"; }
+#endif
+
+  std::vector<std::string> enabled_learners;
+  all.l->get_enabled_learners(enabled_learners);
+  for (const auto& name : enabled_learners)
+  {
+    if (name != "gd" && name != "count_label" && name != "binary" && name.compare(0, 6, "scorer") != 0)
+    {
+      return fmt::format("reduction '{}' is not supported", name);
+    }
+  }
+  return "";
+}
+
 // single_example_handler / multi_example_handler - consumer classes with on_example handle method, incapsulating
 // creation of example / multi_ex and passing it to context.process
 template <typename context_type>
@@ -290,8 +579,30 @@ void generic_driver(ready_examples_queue& examples, context_type& context)
   drain_examples(context.get_master());
 }
 
+void hogwild_driver(VW::workspace& all)
+{
+  hogwild_learners learners(all, all.runtime_config.learner_threads);
+  hogwild_context context(learners);
+  ready_examples_queue examples(all);
+  single_example_handler<hogwild_context> handler(context);
+  process_examples(examples, handler);
+  learners.wait_all();
+  drain_examples(all);
+}
+
 void generic_driver(VW::workspace& all)
 {
+  if (all.runtime_config.learner_threads > 1)
+  {
+    const auto reason = hogwild_unsupported_reason(all);
+    if (reason.empty())
+    {
+      hogwild_driver(all);
+      return;
+    }
+    all.logger.err_warn("--learner_threads is ignored and a single learner thread is used: {}", reason);
+  }
+
   single_instance_context context(all);
   ready_examples_queue examples(all);
   generic_driver(examples, context);
@@ -378,6 +689,11 @@ void learner::debug_log_message(polymorphic_ex ex, const std::string& msg)
 void learner::learn(polymorphic_ex ec, size_t i)
 {
   assert(is_multiline() == ec.is_multiline());
+  if (_fused && i == 0)
+  {
+    _learn_direct(ec);
+    return;
+  }
   details::increment_offset(ec, feature_width_below, i);
   debug_log_message(ec, "learn");
   _learn_f(ec);
@@ -387,6 +703,11 @@ void learner::learn(polymorphic_ex ec, size_t i)
 void learner::predict(polymorphic_ex ec, size_t i)
 {
   assert(is_multiline() == ec.is_multiline());
+  if (_fused && i == 0)
+  {
+    _predict_direct(ec);
+    return;
+  }
   details::increment_offset(ec, feature_width_below, i);
   debug_log_message(ec, "predict");
   _predict_f(ec);
@@ -418,6 +739,21 @@ void learner::multipredict(polymorphic_ex ec, size_t lo, size_t count, polypredi
   }
 }
 
+void learner::predict_batch(example* const* examples, size_t count, size_t i)
+{
+  assert(!is_multiline());
+  if (_predict_batch_f == nullptr)
+  {
+    for (size_t k = 0; k < count; k++) { predict(*examples[k], i); }
+    return;
+  }
+
+  for (size_t k = 0; k < count; k++) { details::increment_offset(*examples[k], feature_width_below, i); }
+  if (count > 0) { debug_log_message(*examples[0], "predict_batch"); }
+  _predict_batch_f(examples, count);
+  for (size_t k = 0; k < count; k++) { details::decrement_offset(*examples[k], feature_width_below, i); }
+}
+
 void learner::update(polymorphic_ex ec, size_t i)
 {
   assert(is_multiline() == ec.is_multiline());
@@ -427,6 +763,26 @@ void learner::update(polymorphic_ex ec, size_t i)
   details::decrement_offset(ec, feature_width_below, i);
 }
 
+void learner::multiupdate(example& ec, size_t lo, size_t count, const float* labels, const polyprediction* pred)
+{
+  assert(!is_multiline());
+  details::increment_offset(ec, feature_width_below, lo);
+  debug_log_message(ec, "multiupdate");
+  if (_multiupdate_f == nullptr)
+  {
+    for (size_t c = 0; c < count; c++)
+    {
+      ec.l.simple.label = labels[c];
+      ec.pred.scalar = pred[c].scalar;
+      _update_f(ec);
+      details::increment_offset(ec, feature_width_below, 1);
+    }
+    details::decrement_offset(ec, feature_width_below, count);
+  }
+  else { _multiupdate_f(ec, count, feature_width_below, labels, pred); }
+  details::decrement_offset(ec, feature_width_below, lo);
+}
+
 float learner::sensitivity(example& ec, size_t i)
 {
   details::increment_offset(ec, feature_width_below, i);
@@ -654,6 +1010,22 @@ void learner::subtract(const VW::workspace& ws1, const VW::workspace& ws2, const
   else { THROW("learner " << name << " does not support subtraction to generate a delta."); }
 }
 
+size_t learner::fuse_stack()
+{
+  // With stack tracking the depth of every example is adjusted in each layer, so the dynamic path is required.
+  if (vw_dbg::TRACK_STACK) { return 0; }
+
+  size_t fused = 0;
+  for (learner* l = this; l != nullptr; l = l->get_base_learner())
+  {
+    // Learners without direct entry points keep dispatching through std::function.
+    if (l->_learn_direct.thunk == nullptr || l->_predict_direct.thunk == nullptr) { continue; }
+    l->_fused = true;
+    fused++;
+  }
+  return fused;
+}
+
 std::shared_ptr<learner> learner::create_learner_above_this()
 {
   // Copy this learner and give the new learner ownership of this learner.
@@ -668,8 +1040,15 @@ std::shared_ptr<learner> learner::create_learner_above_this()
   l->_print_update_f = nullptr;
   l->_cleanup_example_f = nullptr;
 
+  // The new learner sets its own learn and predict functions and is only fused once the whole stack exists.
+  l->_learn_direct = details::direct_call();
+  l->_predict_direct = details::direct_call();
+  l->_fused = false;
+
   // Don't propagate these functions
   l->_multipredict_f = nullptr;
+  l->_multiupdate_f = nullptr;
+  l->_predict_batch_f = nullptr;
   l->_save_load_f = nullptr;
   l->_pre_save_load_f = nullptr;
   l->_end_pass_f = nullptr;
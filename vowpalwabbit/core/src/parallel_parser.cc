@@ -0,0 +1,251 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/parallel_parser.h"
+
+#include "vw/cache_parser/parse_example_cache.h"
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/parser.h"
+#include "vw/io/io_adapter.h"
+#include "vw/text_parser/parse_example_text.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+// Number of unsuccessful attempts to find work before a worker parks itself.
+constexpr size_t SPINS_BEFORE_PARKING = 64;
+
+uint64_t round_up_to_power_of_two(uint64_t v)
+{
+  uint64_t result = 1;
+  while (result < v) { result <<= 1; }
+  return result;
+}
+}  // namespace
+
+VW::details::parallel_parser::parallel_parser(VW::workspace& all, size_t num_threads, size_t ring_size)
+    : _all(all)
+    , _slots(round_up_to_power_of_two(std::max<size_t>(ring_size, 2)))
+    , _mask(_slots.size() - 1)
+    // Scratch 0 belongs to the parse thread which also parses while it waits.
+    , _scratch(num_threads + 1)
+{
+  try
+  {
+    for (size_t i = 0; i < num_threads; ++i) { _workers.emplace_back(&parallel_parser::worker_loop, this, i + 1); }
+  }
+  catch (...)
+  {
+    _stop = true;
+    wake_workers();
+    for (auto& worker : _workers) { worker.join(); }
+    throw;
+  }
+}
+
+VW::details::parallel_parser::~parallel_parser()
+{
+  _stop.store(true);
+  wake_workers();
+  for (auto& worker : _workers)
+  {
+    if (worker.joinable()) { worker.join(); }
+  }
+}
+
+void VW::details::parallel_parser::wake_workers()
+{
+  if (_num_parked.load() > 0)
+  {
+    // Taking the lock orders this notification after a worker's last check of the ring.
+    std::lock_guard<std::mutex> lock(_park_mutex);
+    _park_cv.notify_all();
+  }
+}
+
+bool VW::details::parallel_parser::try_parse_one(worker_scratch& scratch)
+{
+  uint64_t seq = _claim.load(std::memory_order_relaxed);
+  do {
+    if (seq >= _tail.load(std::memory_order_acquire)) { return false; }
+  } while (!_claim.compare_exchange_weak(seq, seq + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+  auto& s = _slots[seq & _mask];
+  try
+  {
+    if (s.format == record_format::TEXT)
+    {
+      VW::parsers::text::details::substring_to_example(
+          &_all, s.ex, VW::string_view(s.record.data(), s.record.size()), scratch.words, scratch.reuse_mem);
+    }
+    else
+    {
+      scratch.record_buf.close_files();
+      scratch.record_buf.add_file(VW::io::create_buffer_view(s.record.data(), s.record.size()));
+      scratch.record_buf.reset();
+      scratch.examples.assign(1, s.ex);
+      s.bytes_consumed =
+          static_cast<size_t>(VW::parsers::cache::read_example_from_cache(&_all, scratch.record_buf, scratch.examples));
+    }
+  }
+  catch (...)
+  {
+    // Rethrown on the parse thread when this slot is handed out, so errors surface in input order.
+    s.exc = std::current_exception();
+  }
+  s.state.store(PARSED, std::memory_order_release);
+  return true;
+}
+
+void VW::details::parallel_parser::worker_loop(size_t worker_index)
+{
+  auto& scratch = _scratch[worker_index];
+  size_t idle_spins = 0;
+  while (!_stop.load(std::memory_order_relaxed))
+  {
+    if (try_parse_one(scratch))
+    {
+      idle_spins = 0;
+      continue;
+    }
+
+    if (++idle_spins < SPINS_BEFORE_PARKING)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_park_mutex);
+    _num_parked.fetch_add(1);
+    // The timeout is only a safety net, the producer wakes parked workers after publishing new records.
+    _park_cv.wait_for(lock, std::chrono::milliseconds(100),
+        [this] { return _stop.load() || _claim.load() < _tail.load(); });
+    _num_parked.fetch_sub(1);
+    idle_spins = 0;
+  }
+}
+
+bool VW::details::parallel_parser::read_record(io_buf& buf, slot& s, record_format format)
+{
+  s.format = format;
+  if (format == record_format::TEXT)
+  {
+    char* line = nullptr;
+    size_t num_chars = 0;
+    const size_t bytes_consumed = VW::parsers::text::details::read_features(buf, line, num_chars);
+    if (bytes_consumed < 1) { return false; }
+    // The io_buf may shift its contents on the next read so the line has to be copied out.
+    s.record.assign(line, line + num_chars);
+    s.bytes_consumed = bytes_consumed;
+    return true;
+  }
+
+  // Every cached example starts with its size, so it can be split off without decoding it.
+  char* read_head = nullptr;
+  if (buf.buf_read(read_head, sizeof(uint64_t)) < sizeof(uint64_t)) { return false; }
+  uint64_t example_size = 0;
+  std::memcpy(&example_size, read_head, sizeof(uint64_t));
+  s.record.resize(sizeof(uint64_t));
+  std::memcpy(s.record.data(), &example_size, sizeof(uint64_t));
+  // A truncated example is copied as far as it goes, decoding it reports the error in input order.
+  const size_t available = buf.buf_read(read_head, example_size);
+  s.record.insert(s.record.end(), read_head, read_head + available);
+  return true;
+}
+
+int VW::details::parallel_parser::read(io_buf& buf, VW::multi_ex& examples, record_format format)
+{
+  assert(examples.size() == 1);
+  VW::example* unused = examples[0];
+
+  // Keep the ring full so that the workers always have something to parse.
+  uint64_t tail = _tail.load(std::memory_order_relaxed);
+  const uint64_t initial_tail = tail;
+  while (!_input_exhausted && tail - _head < _slots.size())
+  {
+    auto& s = _slots[tail & _mask];
+    if (!read_record(buf, s, format))
+    {
+      _input_exhausted = true;
+      break;
+    }
+    // Examples are used in the order they were taken from the pool to keep example_counter increasing.
+    if (!_spare_examples.empty())
+    {
+      s.ex = _spare_examples.front();
+      _spare_examples.pop_front();
+    }
+    else if (unused != nullptr) { s.ex = std::exchange(unused, nullptr); }
+    else { s.ex = &VW::get_unused_example(&_all); }
+
+    ++tail;
+    _tail.store(tail);
+  }
+  if (tail != initial_tail) { wake_workers(); }
+
+  if (_head == tail)
+  {
+    // Everything has been handed out. Allow reading again once the caller has reset the source.
+    _input_exhausted = false;
+    return 0;
+  }
+
+  auto& head = _slots[_head & _mask];
+  while (head.state.load(std::memory_order_acquire) != PARSED)
+  {
+    if (!try_parse_one(_scratch[0])) { std::this_thread::yield(); }
+  }
+
+  head.state.store(EMPTY, std::memory_order_relaxed);
+  ++_head;
+  if (unused != nullptr) { _spare_examples.push_back(unused); }
+  examples[0] = std::exchange(head.ex, nullptr);
+
+  if (head.exc)
+  {
+    // examples[0] now holds the example of the failed record so the caller's error handling returns it to the pool.
+    std::rethrow_exception(std::exchange(head.exc, nullptr));
+  }
+  return static_cast<int>(head.bytes_consumed);
+}
+
+void VW::details::parallel_parser::discard_pending()
+{
+  VW::multi_ex pending;
+  const uint64_t tail = _tail.load(std::memory_order_relaxed);
+  for (; _head != tail; ++_head)
+  {
+    auto& s = _slots[_head & _mask];
+    // Lines that are still being parsed by a worker must finish before their example can be reused.
+    while (s.state.load(std::memory_order_acquire) != PARSED)
+    {
+      if (!try_parse_one(_scratch[0])) { std::this_thread::yield(); }
+    }
+    s.state.store(EMPTY, std::memory_order_relaxed);
+    s.exc = nullptr;
+    pending.push_back(std::exchange(s.ex, nullptr));
+  }
+  pending.insert(pending.end(), _spare_examples.begin(), _spare_examples.end());
+  _spare_examples.clear();
+  _input_exhausted = false;
+  VW::return_multiple_example(_all, pending);
+}
+
+int VW::details::read_features_string_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples)
+{
+  return all->parser_runtime.example_parser->parallel->read(
+      buf, examples, VW::details::parallel_parser::record_format::TEXT);
+}
+
+int VW::details::read_example_from_cache_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples)
+{
+  return all->parser_runtime.example_parser->parallel->read(
+      buf, examples, VW::details::parallel_parser::record_format::CACHE);
+}
@@ -304,6 +304,7 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
   bool version_arg = false;
   bool help = false;
   bool skip_driver = false;
+  bool dynamic_reduction_stack = false;
   std::string progress_arg;
   option_group_definition diagnostic_group("Diagnostic");
   diagnostic_group.add(make_option("version", version_arg).help("Version information"))
@@ -313,11 +314,16 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
                .help("Progress update frequency. int: additive, float: multiplicative"))
       .add(make_option("dry_run", skip_driver)
                .help("Parse arguments and print corresponding metadata. Will not execute driver"))
+      .add(make_option("dynamic_reduction_stack", dynamic_reduction_stack)
+               .experimental()
+               .help("Dispatch learn and predict through every learner of the reduction stack instead of letting "
+                     "the learners call each other directly"))
       .add(make_option("help", help)
                .short_name("h")
                .help("More information on vowpal wabbit can be found here https://vowpalwabbit.org"));
 
   options.add_and_parse(diagnostic_group);
+  all.runtime_config.fuse_reduction_stack = !dynamic_reduction_stack;
 
   if (help)
   {
@@ -392,6 +398,14 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
                .help("Number of children for persistent daemon mode"))
       .add(make_option("pid_file", parsed_options.pid_file).help("Write pid file in persistent daemon mode"))
       .add(make_option("port_file", parsed_options.port_file).help("Write port used in persistent daemon mode"))
+      .add(make_option("daemon_event_loop", parsed_options.daemon_event_loop)
+               .help("In persistent daemon mode, serve all connections from one process with an event loop and a "
+                     "single model instead of forking --num_children children. Linux only, text input only")
+               .experimental())
+      .add(make_option("daemon_batch_size", parsed_options.daemon_batch_size)
+               .default_value(64)
+               .help("Maximum number of examples gathered across connections into one batch with --daemon_event_loop")
+               .experimental())
 #endif
       .add(make_option("cache", parsed_options.cache).short_name("c").help("Use a cache.  The default is <data>.cache"))
       .add(make_option("cache_file", parsed_options.cache_files).help("The location(s) of cache_file"))
@@ -448,9 +462,13 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
       (options.was_supplied("port") && !all.reduction_state.active))
   {
     all.runtime_config.daemon = true;
-    // allow each child to process up to 1e5 connections
-    all.runtime_config.numpasses = static_cast<size_t>(1e5);
+    // Active learning talks to its own protocol on the daemon socket.
+    all.runtime_config.daemon_event_loop = parsed_options.daemon_event_loop && !all.reduction_state.active;
+    all.runtime_config.daemon_batch_size = VW::cast_to_smaller_type<size_t>(parsed_options.daemon_batch_size);
+    // allow each child to process up to 1e5 connections, the event loop serves every connection in a single pass
+    if (!all.runtime_config.daemon_event_loop) { all.runtime_config.numpasses = static_cast<size_t>(1e5); }
   }
+  if (parsed_options.daemon_batch_size == 0) { THROW("--daemon_batch_size must be greater than 0"); }
 #endif
 
   // Add an implicit cache file based on the data filename.
@@ -559,6 +577,7 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
 
   bool noconstant;
   bool leave_duplicate_interactions;
+  uint64_t interaction_expansion_cache;
   std::string affix;
 
   option_group_definition feature_options("Feature");
@@ -627,9 +646,16 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
                .help("Don't remove interactions with duplicate combinations of namespaces. For ex. this is a "
                      "duplicate: '-q ab -q ba' and a lot more in '-q ::'."))
       .add(make_option("quadratic", quadratics).short_name("q").keep().help("Create and use quadratic features"))
-      .add(make_option("cubic", cubics).keep().help("Create and use cubic features"));
+      .add(make_option("cubic", cubics).keep().help("Create and use cubic features"))
+      .add(make_option("interaction_expansion_cache", interaction_expansion_cache)
+               .default_value(0)
+               .experimental()
+               .help("Keep the expanded interaction features of each example for up to <arg> interaction sets and "
+                     "reuse them across predict, learn and model offsets. 0 disables the cache"));
 
   options.add_and_parse(feature_options);
+  all.runtime_state.generate_interactions_object_cache_state.max_cached_expansions =
+      static_cast<size_t>(interaction_expansion_cache);
 
   // feature manipulation
   all.parser_runtime.example_parser->hasher = VW::get_hasher(hash_function);
@@ -1324,6 +1350,11 @@ void parse_output_model(options_i& options, VW::workspace& all)
                      "writing a model."))
       .add(make_option("save_per_pass", all.output_model_config.save_per_pass)
                .help("Save the model after every pass over data"))
+      .add(make_option("dense_model_layout", all.output_model_config.dense_model_layout)
+               .help("Save dense weights, including the extra state of the update rule, as a single page aligned block "
+                     "so that the model can be loaded with --mmap_model. Models in this layout cannot be read by older "
+                     "versions")
+               .experimental())
       .add(make_option("output_feature_regularizer_binary", all.output_model_config.per_feature_regularizer_output)
                .help("Per feature regularization output file"))
       .add(make_option("output_feature_regularizer_text", all.output_model_config.per_feature_regularizer_text)
@@ -1490,17 +1521,24 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
   bool strict_parse = false;
   int ring_size_tmp;
   int64_t example_queue_limit_tmp;
+  uint64_t parse_threads;
   option_group_definition vw_args("Parser");
   vw_args.add(make_option("ring_size", ring_size_tmp).default_value(256).help("Size of example ring"))
       .add(make_option("example_queue_limit", example_queue_limit_tmp)
                .default_value(256)
                .help("Max number of examples to store after parsing but before the learner has processed. Rarely "
                      "needs to be changed."))
-      .add(make_option("strict_parse", strict_parse).help("Throw on malformed examples"));
+      .add(make_option("strict_parse", strict_parse).help("Throw on malformed examples"))
+      .add(make_option("parse_threads", parse_threads)
+               .default_value(1)
+               .help("Number of threads used to parse text format or cache input. Examples are still passed to the "
+                     "learner in input order. Input is read ahead when more than one thread is used")
+               .experimental());
   all->options->add_and_parse(vw_args);
 
   if (ring_size_tmp <= 0) { THROW("ring_size should be positive") }
   if (example_queue_limit_tmp <= 0) { THROW("ring_size should be positive") }
+  if (parse_threads == 0) { THROW("parse_threads should be positive") }
   auto ring_size = static_cast<size_t>(ring_size_tmp);
   auto example_queue_limit = static_cast<size_t>(example_queue_limit_tmp);
   auto final_example_queue_limit = example_queue_limit;
@@ -1516,6 +1554,7 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
   }
 
   all->parser_runtime.example_parser = VW::make_unique<VW::parser>(final_example_queue_limit, strict_parse);
+  all->parser_runtime.example_parser->num_parse_threads = static_cast<size_t>(parse_threads);
 
   option_group_definition weight_args("Weight");
   weight_args
@@ -1532,6 +1571,11 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
       .add(make_option("truncated_normal_weights", all->initial_weights_config.tnormal_weights)
                .help("Make initial weights truncated normal"))
       .add(make_option("sparse_weights", all->weights.sparse).help("Use a sparse datastructure for weights"))
+      .add(make_option("mmap_model", all->initial_weights_config.mmap_model)
+               .help("Memory map the weights of an initial regressor saved with --dense_model_layout instead of "
+                     "reading them. Processes loading the same model share its pages until they learn, which copies "
+                     "the pages written to. The model file must not be modified while it is in use")
+               .experimental())
       .add(make_option("input_feature_regularizer", all->initial_weights_config.per_feature_regularizer_input)
                .help("Per feature regularization input file"));
   all->options->add_and_parse(weight_args);
@@ -1542,6 +1586,9 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
   uint64_t unique_id_arg;
   uint64_t total_arg;
   uint64_t node_arg;
+  uint64_t learner_threads_arg;
+  std::string all_reduce_algorithm_arg;
+  bool sparse_all_reduce_arg = false;
   option_group_definition parallelization_args("Parallelization");
   parallelization_args
       .add(make_option("span_server", span_server_arg).help("Location of server for setting up spanning tree"))
@@ -1551,9 +1598,31 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
       .add(make_option("node", node_arg).default_value(0).help("Node number in cluster parallel job"))
       .add(make_option("span_server_port", span_server_port_arg)
                .default_value(26543)
-               .help("Port of the server for setting up spanning tree"));
+               .help("Port of the server for setting up spanning tree"))
+      .add(make_option("all_reduce_algorithm", all_reduce_algorithm_arg)
+               .default_value("tree")
+               .one_of({"tree", "ring", "halving"})
+               .help("How the nodes of a cluster parallel job combine their buffers. tree reduces and broadcasts over "
+                     "the spanning tree, ring and halving (recursive halving and doubling) connect the nodes directly "
+                     "and only use the spanning tree server to find each other. All nodes must use the same value")
+               .experimental())
+      .add(make_option("sparse_all_reduce", sparse_all_reduce_arg)
+               .help("When accumulating weights or gradients across nodes, only exchange the non-zero entries with "
+                     "delta encoded indices. Falls back to exchanging the dense vector when that is smaller. All nodes "
+                     "must use the same value")
+               .experimental())
+      .add(make_option("learner_threads", learner_threads_arg)
+               .default_value(1)
+               .help("Number of threads which learn from examples concurrently with lock free (Hogwild) updates to the "
+                     "shared weights. Results are no longer deterministic and examples are finished in completion "
+                     "order. Only supported for plain gd learners, others fall back to a single thread")
+               .experimental());
   all->options->add_and_parse(parallelization_args);
 
+  if (learner_threads_arg == 0) { THROW("learner_threads should be positive") }
+  all->runtime_config.learner_threads = static_cast<size_t>(learner_threads_arg);
+  all->runtime_config.sparse_all_reduce = sparse_all_reduce_arg;
+
   // total, unique_id and node must be specified together.
   if ((all->options->was_supplied("total") || all->options->was_supplied("node") ||
           all->options->was_supplied("unique_id")) &&
@@ -1565,11 +1634,14 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
 
   if (all->options->was_supplied("span_server"))
   {
+    auto algorithm = VW::all_reduce_algorithm::TREE;
+    if (all_reduce_algorithm_arg == "ring") { algorithm = VW::all_reduce_algorithm::RING; }
+    else if (all_reduce_algorithm_arg == "halving") { algorithm = VW::all_reduce_algorithm::RECURSIVE_HALVING; }
     all->runtime_config.selected_all_reduce_type = VW::all_reduce_type::SOCKET;
     all->runtime_state.all_reduce.reset(
         new VW::all_reduce_sockets(span_server_arg, VW::cast_to_smaller_type<int>(span_server_port_arg),
             VW::cast_to_smaller_type<size_t>(unique_id_arg), VW::cast_to_smaller_type<size_t>(total_arg),
-            VW::cast_to_smaller_type<size_t>(node_arg), all->output_config.quiet));
+            VW::cast_to_smaller_type<size_t>(node_arg), all->output_config.quiet, algorithm));
   }
 
   parse_diagnostics(*all->options, *all);
@@ -1712,16 +1784,17 @@ void VW::details::instantiate_learner(VW::workspace& all, std::unique_ptr<VW::se
 
 void VW::details::parse_sources(options_i& options, VW::workspace& all, VW::io_buf& model, bool skip_model_load)
 {
+  // force feature_width to be a power of 2 to avoid 32-bit overflow
+  // This is known before the model is loaded since sparse weights allocate each model's weights separately.
+  uint32_t interleave_shifts = 0;
+  while (all.l->feature_width_below > (static_cast<uint64_t>(1) << interleave_shifts)) { interleave_shifts++; }
+  all.reduction_state.total_feature_width = (1 << interleave_shifts) >> all.weights.stride_shift();
+
   if (!skip_model_load) { load_input_model(all, model); }
   else { model.close_file(); }
 
   auto parsed_source_options = parse_source(all, options);
   enable_sources(all, all.output_config.quiet, all.runtime_config.numpasses, parsed_source_options);
-
-  // force feature_width to be a power of 2 to avoid 32-bit overflow
-  uint32_t interleave_shifts = 0;
-  while (all.l->feature_width_below > (static_cast<uint64_t>(1) << interleave_shifts)) { interleave_shifts++; }
-  all.reduction_state.total_feature_width = (1 << interleave_shifts) >> all.weights.stride_shift();
 }
 
 void VW::details::print_enabled_learners(VW::workspace& all, std::vector<std::string>& enabled_learners)
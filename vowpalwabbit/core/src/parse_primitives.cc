@@ -10,11 +10,223 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+namespace
+{
+// Normalized 128 bit approximations of 5^q for the decimal exponents q in [SMALLEST_FLOAT_POW10, LARGEST_FLOAT_POW10],
+// high word first. Decimals outside of that range are zero or infinite as floats.
+constexpr int SMALLEST_FLOAT_POW10 = -65;
+constexpr int LARGEST_FLOAT_POW10 = 38;
+constexpr uint64_t POWERS_OF_FIVE_128[2 * (LARGEST_FLOAT_POW10 - SMALLEST_FLOAT_POW10 + 1)] = {
+    0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+    0xa87fea27a539e9a5, 0x3f2398d747b36224,
+    0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+    0x83a3eeeef9153e89, 0x1953cf68300424ac,
+    0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+    0xcdb02555653131b6, 0x3792f412cb06794d,
+    0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4,
+    0xc8de047564d20a8b, 0xf245825a5a445275,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56712,
+    0x9ced737bb6c4183d, 0x55464dd69685606b,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b886,
+    0xf53304714d9265df, 0xd53dd99f4b3066a8,
+    0x993fe2c6d07b7fab, 0xe546a8038efe4029,
+    0xbf8fdb78849a5f96, 0xde98520472bdd033,
+    0xef73d256a5c0f77c, 0x963e66858f6d4440,
+    0x95a8637627989aad, 0xdde7001379a44aa8,
+    0xbb127c53b17ec159, 0x5560c018580d5d52,
+    0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+    0x9226712162ab070d, 0xcab3961304ca70e8,
+    0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506a,
+    0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+    0xb267ed1940f1c61c, 0x55f038b237591ed3,
+    0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da015,
+    0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+    0xd9c7dced53c72255, 0x96e7bd358c904a21,
+    0x881cea14545c7575, 0x7e50d64177da2e54,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9e9,
+    0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113e,
+    0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+    0xcfb11ead453994ba, 0x67de18eda5814af2,
+    0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+    0xa2425ff75e14fc31, 0xa1258379a94d028d,
+    0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fc,
+    0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e,
+    0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543,
+    0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+    0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+    0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+    0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+    0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95,
+    0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+    0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+    0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+    0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+    0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9,
+    0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+    0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000,
+    0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000,
+    0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000,
+    0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000,
+    0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000,
+    0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000,
+    0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000,
+    0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000,
+    0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000,
+    0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000,
+    0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000,
+    0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000,
+    0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000,
+    0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000,
+    0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000,
+    0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000,
+    0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000,
+    0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000,
+    0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000};
+
+void multiply_128(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low)
+{
+  const uint64_t a_low = a & 0xFFFFFFFF;
+  const uint64_t a_high = a >> 32;
+  const uint64_t b_low = b & 0xFFFFFFFF;
+  const uint64_t b_high = b >> 32;
+  const uint64_t low_low = a_low * b_low;
+  const uint64_t high_low = a_high * b_low;
+  const uint64_t low_high = a_low * b_high;
+  const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + (low_high & 0xFFFFFFFF);
+  high = a_high * b_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+  low = (middle << 32) | (low_low & 0xFFFFFFFF);
+}
+
+// value must not be zero.
+int count_leading_zeros(uint64_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanReverse64(&index, value);
+  return 63 - static_cast<int>(index);
+#else
+  return __builtin_clzll(value);
+#endif
+}
+}  // namespace
+
+float VW::details::decimal_to_float(uint64_t significand, int exponent)
+{
+  // Eisel-Lemire: the significand times the truncated power of five is accurate enough in 64 bits to round to the 24
+  // bits of a float. Only when the bits below the rounding position are all ones can the truncated part matter, and
+  // the second word of the power of five settles it.
+  constexpr int MANTISSA_BITS = 23;
+  constexpr int MINIMUM_EXPONENT = -127;
+  constexpr int INFINITE_POWER = 0xFF;
+  if (significand == 0 || exponent < SMALLEST_FLOAT_POW10) { return 0.f; }
+  if (exponent > LARGEST_FLOAT_POW10) { return std::numeric_limits<float>::infinity(); }
+
+  const int leading_zeros = count_leading_zeros(significand);
+  significand <<= leading_zeros;
+  const int index = 2 * (exponent - SMALLEST_FLOAT_POW10);
+  uint64_t high = 0;
+  uint64_t low = 0;
+  multiply_128(significand, POWERS_OF_FIVE_128[index], high, low);
+  constexpr uint64_t PRECISION_MASK = ~static_cast<uint64_t>(0) >> (MANTISSA_BITS + 3);
+  if ((high & PRECISION_MASK) == PRECISION_MASK)
+  {
+    uint64_t second_high = 0;
+    uint64_t second_low = 0;
+    multiply_128(significand, POWERS_OF_FIVE_128[index + 1], second_high, second_low);
+    low += second_high;
+    if (second_high > low) { high++; }
+  }
+
+  const int upper_bit = static_cast<int>(high >> 63);
+  const int shift = upper_bit + 64 - MANTISSA_BITS - 3;
+  uint64_t mantissa = high >> shift;
+  // floor(exponent * log2(10)) + 63 is the binary exponent of the normalized power of ten.
+  int power2 = (((152170 + 65536) * exponent) >> 16) + 63 + upper_bit - leading_zeros - MINIMUM_EXPONENT;
+
+  if (power2 <= 0)
+  {
+    // Subnormal, or zero once rounded.
+    if (-power2 + 1 >= 64) { return 0.f; }
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    power2 = mantissa < (static_cast<uint64_t>(1) << MANTISSA_BITS) ? 0 : 1;
+  }
+  else
+  {
+    // A product which is exact and halfway between two floats rounds to even. It can only be exact for small
+    // exponents.
+    if (low <= 1 && exponent >= -17 && exponent <= 10 && (mantissa & 3) == 1 && (mantissa << shift) == high)
+    {
+      mantissa &= ~static_cast<uint64_t>(1);
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (static_cast<uint64_t>(2) << MANTISSA_BITS))
+    {
+      mantissa = static_cast<uint64_t>(1) << MANTISSA_BITS;
+      power2++;
+    }
+    mantissa &= ~(static_cast<uint64_t>(1) << MANTISSA_BITS);
+    if (power2 >= INFINITE_POWER) { return std::numeric_limits<float>::infinity(); }
+  }
+
+  const uint32_t bits = static_cast<uint32_t>(mantissa) | (static_cast<uint32_t>(power2) << MANTISSA_BITS);
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
 std::vector<std::string> VW::details::escaped_tokenize(char delim, VW::string_view s, bool allow_empty)
 {
   std::vector<std::string> tokens;
@@ -120,7 +120,11 @@ void initialize_regressor(VW::workspace& all, T& weights)
 
 void VW::details::initialize_regressor(VW::workspace& all)
 {
-  if (all.weights.sparse) { ::initialize_regressor(all, all.weights.sparse_weights); }
+  if (all.weights.sparse)
+  {
+    ::initialize_regressor(all, all.weights.sparse_weights);
+    all.weights.sparse_weights.set_model_width(all.reduction_state.total_feature_width);
+  }
   else { ::initialize_regressor(all, all.weights.dense_weights); }
 }
 
@@ -162,14 +162,30 @@ uint32_t cache_numbits(VW::io::reader& cache_reader)
   return cache_numbits;
 }
 
+// Returns true if input should be parsed by several threads, creating the parallel parser if needed.
+bool use_parallel_parser(VW::workspace& all)
+{
+  auto& p = *all.parser_runtime.example_parser;
+  if (p.num_parse_threads <= 1) { return false; }
+  // The parse thread parses as well so it only needs num_parse_threads - 1 helpers.
+  if (p.parallel == nullptr)
+  {
+    p.parallel = VW::make_unique<VW::details::parallel_parser>(all, p.num_parse_threads - 1, p.example_queue_limit);
+  }
+  return true;
+}
+
 void set_cache_reader(VW::workspace& all)
 {
-  all.parser_runtime.example_parser->reader = VW::parsers::cache::read_example_from_cache;
+  all.parser_runtime.example_parser->reader = use_parallel_parser(all)
+      ? VW::details::read_example_from_cache_parallel
+      : VW::parsers::cache::read_example_from_cache;
 }
 
 void set_string_reader(VW::workspace& all)
 {
-  all.parser_runtime.example_parser->reader = VW::parsers::text::read_features_string;
+  all.parser_runtime.example_parser->reader =
+      use_parallel_parser(all) ? VW::details::read_features_string_parallel : VW::parsers::text::read_features_string;
   all.print_by_ref = VW::details::print_result_by_ref;
 }
 
@@ -492,6 +508,17 @@ void VW::details::enable_sources(
       pid_file.close();
     }
 
+    if (all.runtime_config.daemon_event_loop)
+    {
+      if (input_options.json || input_options.dsjson) { THROW("--daemon_event_loop only supports text input"); }
+      // Connections are accepted and parsed by run_event_daemon() rather than by the parser thread.
+      if (!all.output_config.quiet)
+      {
+        *(all.output_runtime.trace_message) << "serving connections on port " << port << " from one event loop" << endl;
+      }
+      return;
+    }
+
     if (all.runtime_config.daemon && !all.reduction_state.active)
     {
       // See support notes here: https://github.com/VowpalWabbit/vowpal_wabbit/wiki/Daemon-example
@@ -597,6 +624,13 @@ void VW::details::enable_sources(
     all.parser_runtime.example_parser->input.add_file(socket->get_reader());
     if (!all.output_config.quiet) { *(all.output_runtime.trace_message) << "reading data from port " << port << endl; }
 
+    // Reading ahead would block on the socket waiting for lines the client has not sent yet.
+    if (all.parser_runtime.example_parser->num_parse_threads > 1)
+    {
+      all.logger.err_warn("--parse_threads is not supported in daemon or active mode, using a single parse thread.");
+      all.parser_runtime.example_parser->num_parse_threads = 1;
+    }
+
     if (all.reduction_state.active) { set_string_reader(all); }
     else { set_daemon_reader(all, input_options.json, input_options.dsjson); }
     all.parser_runtime.example_parser->resettable =
@@ -737,4 +771,11 @@ void VW::details::free_parser(VW::workspace& all)
 
   // There should be no examples in flight at this point.
   assert(all.parser_runtime.example_parser->ready_parsed_examples.size() == 0);
+
+  // Hand back examples that were read ahead by the parallel parser and stop its threads.
+  if (all.parser_runtime.example_parser->parallel != nullptr)
+  {
+    all.parser_runtime.example_parser->parallel->discard_pending();
+    all.parser_runtime.example_parser->parallel.reset();
+  }
 }
@@ -302,7 +302,9 @@ std::shared_ptr<VW::LEARNER::learner> default_reduction_stack_setup::setup_base_
     _feature_width_above *= feature_width;
     // 'hacky' way of keeping track of the option group created by the setup_func about to be created
     _options_impl->tint(setup_func_name);
+    _setup_depth++;
     std::shared_ptr<VW::LEARNER::learner> result = setup_func(*this);
+    _setup_depth--;
     _options_impl->reset_tint();
 
     // returning nullptr means that setup_func (any reduction) was not 'enabled' but
@@ -317,6 +319,8 @@ std::shared_ptr<VW::LEARNER::learner> default_reduction_stack_setup::setup_base_
         result->feature_width_below = result->feature_width;
       }
       _reduction_stack.clear();
+      // Only the outermost call returns the complete stack, which can now be fused.
+      if (_setup_depth == 0 && get_all_pointer()->runtime_config.fuse_reduction_stack) { result->fuse_stack(); }
       return result;
     }
   }
@@ -78,7 +78,7 @@ void pre_save_load_automl(VW::workspace& all, automl<CMType>& data)
 
   // Adjust champ weights to new single-model space
   VW::reductions::multi_model::reduce_innermost_model_weights(
-      data.cm->weights, 0, data.cm->feature_width, data.cm->max_live_configs);
+      data.cm->weights.dense_weights, 0, data.cm->feature_width, data.cm->max_live_configs);
 
   for (auto& group : options.get_all_option_group_definitions())
   {
@@ -137,7 +137,7 @@ std::shared_ptr<VW::LEARNER::learner> make_automl_with_impl(VW::setup_base_i& st
     std::string& oracle_type, uint64_t default_lease, VW::workspace& all, int32_t priority_challengers,
     std::string& interaction_type, std::string& priority_type, float automl_significance_level, bool ccb_on,
     bool predict_only_model, bool reversed_learning_order, config_type conf_type, bool trace_logging,
-    bool reward_as_cost, double tol_x, bool is_brentq)
+    bool reward_as_cost, double tol_x, bool is_brentq, uint64_t automl_threads)
 {
   using config_manager_type = interaction_config_manager<T, E>;
 
@@ -163,12 +163,15 @@ std::shared_ptr<VW::LEARNER::learner> make_automl_with_impl(VW::setup_base_i& st
   }
 
   auto cm = VW::make_unique<config_manager_type>(default_lease, max_live_configs, all.get_random_state(),
-      static_cast<uint64_t>(priority_challengers), interaction_type, oracle_type, all.weights.dense_weights,
+      static_cast<uint64_t>(priority_challengers), interaction_type, oracle_type, all.weights,
       calc_priority, automl_significance_level, &all.logger, all.reduction_state.total_feature_width, ccb_on, conf_type,
       trace_file_name_prefix, reward_as_cost, tol_x, is_brentq);
   auto data = VW::make_unique<automl<config_manager_type>>(
       std::move(cm), &all.logger, predict_only_model, trace_file_name_prefix);
   data->debug_reverse_learning_order = reversed_learning_order;
+  data->all = &all;
+  // The calling thread learns the champ.
+  if (automl_threads > 1) { data->threads = VW::make_unique<VW::thread_pool>(automl_threads - 1); }
 
   auto feature_width = max_live_configs;
   auto* persist_ptr = verbose_metrics ? persist<config_manager_type, true> : persist<config_manager_type, false>;
@@ -208,6 +211,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
   bool reward_as_cost = false;
   float tol_x = 1e-6f;
   std::string opt_func = "bisect";
+  uint64_t automl_threads = 1;
 
   option_group_definition new_options("[Reduction] Automl");
   new_options
@@ -279,10 +283,24 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
                .keep()
                .one_of({"bisect", "brentq"})
                .help("Optimization function for estimation)")
+               .experimental())
+      .add(make_option("automl_threads", automl_threads)
+               .default_value(1)
+               .help("Number of threads learning the live configs. Each challenger learns on its own copy of the "
+                     "examples")
                .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
+  if (automl_threads == 0) { THROW("automl_threads should be positive") }
+  // The replicas learning the challengers share the shared data of all, which gd rescales in place under --l1 and --l2.
+  if (automl_threads > 1 && (all.loss_config.l1_lambda != 0.f || all.loss_config.l2_lambda != 0.f))
+  {
+    all.logger.err_warn("--automl_threads is ignored and the configs are learned on one thread: --l1 and --l2 are not "
+                        "supported");
+    automl_threads = 1;
+  }
+
   if (priority_challengers < 0) { priority_challengers = (static_cast<int>(max_live_configs) - 1) / 2; }
 
   if (!fixed_significance_level) { automl_significance_level /= max_live_configs; }
@@ -309,8 +327,10 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
 
   assert(all.feature_tweaks_config.interactions.empty() == true);
 
-  assert(all.weights.sparse == false);
-  if (all.weights.sparse) THROW("--automl does not work with sparse weights");
+  if (all.weights.sparse && predict_only_model)
+  {
+    THROW("--automl does not support --predict_only_model with sparse weights");
+  }
 
   VW::reductions::util::fail_if_enabled(all,
       {"ccb_explore_adf", "audit_regressor", "baseline", "cb_explore_adf_rnd", "cb_to_cb_adf", "cbify", "replay_c",
@@ -331,28 +351,28 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
       return make_automl_with_impl<config_oracle<one_diff_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, automl_threads);
     }
     else if (oracle_type == "rand")
     {
       return make_automl_with_impl<config_oracle<oracle_rand_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, automl_threads);
     }
     else if (oracle_type == "champdupe")
     {
       return make_automl_with_impl<config_oracle<champdupe_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, automl_threads);
     }
     else if (oracle_type == "one_diff_inclusion")
     {
       return make_automl_with_impl<config_oracle<one_diff_inclusion_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, automl_threads);
     }
     else if (oracle_type == "qbase_cubic")
     {
@@ -361,7 +381,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
       return make_automl_with_impl<config_oracle<qbase_cubic>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, automl_threads);
     }
   }
   else
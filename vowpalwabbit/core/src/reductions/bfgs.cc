@@ -19,10 +19,12 @@ Implementation by Miro Dudik.
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/simple_label.h"
+#include "vw/core/thread_pool.h"
 
 #include <fmt/format.h>
 #include <sys/timeb.h>
 
+#include <array>
 #include <cassert>
 #include <cfloat>
 #include <chrono>
@@ -30,6 +32,9 @@ Implementation by Miro Dudik.
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <vector>
 
 #ifndef _WIN32
 #  include <netdb.h>
@@ -62,6 +67,7 @@ using namespace VW::config;
 /********************************************************************/
 // mem[2*i] = y_t
 // mem[2*i+1] = s_t
+// Each of them is an array of one float per weight, starting at mem + ((slot + origin) % mem_stride) * mem_length.
 //
 // w[0] = weight
 // w[1] = accumulated first derivative
@@ -98,8 +104,10 @@ public:
 
   // set by initializer
   int mem_stride = 0;
+  size_t mem_length = 0;  // number of weights, the length of every correction in mem
   bool output_regularizer = false;
   float* mem = nullptr;
+  std::unique_ptr<VW::thread_pool> threads;  // splits the sweeps over dense weights, null when running on one thread
   double* rho = nullptr;
   double* alpha = nullptr;
 
@@ -199,26 +207,67 @@ float dot_with_direction(VW::workspace& all, VW::example& ec)
   return temp;
 }
 
+using sweep_sums = std::array<double, 4>;
+
+// The corrections are stored correction major, so that every sweep reads each of them as one contiguous array.
+inline float* mem_slot(const bfgs& b, float* mem, int slot, int origin)
+{
+  return mem + static_cast<size_t>((slot + origin) % b.mem_stride) * b.mem_length;
+}
+
+// Calls f(w, i, sums) for every weight, with w pointing at the strided weight of index i, and returns the sums f
+// accumulated. Dense weights are split into contiguous ranges over the bfgs threads and the sums of the ranges are
+// added in order, so results only depend on the number of threads.
+template <class F>
+sweep_sums sweep(bfgs& b, VW::dense_parameters& weights, F&& f)
+{
+  float* first = weights.data();
+  const uint32_t stride_shift = weights.stride_shift();
+  auto sweep_range = [first, stride_shift, &f](uint64_t begin, uint64_t end)
+  {
+    sweep_sums sums{};
+    for (uint64_t i = begin; i < end; i++) { f(first + (i << stride_shift), i, sums); }
+    return sums;
+  };
+  if (b.threads == nullptr) { return sweep_range(0, b.mem_length); }
+
+  const uint64_t ranges = b.threads->size();
+  std::vector<std::future<sweep_sums>> futures;
+  futures.reserve(ranges);
+  for (uint64_t range = 0; range < ranges; range++)
+  {
+    futures.push_back(b.threads->submit(
+        sweep_range, b.mem_length * range / ranges, b.mem_length * (range + 1) / ranges));
+  }
+  sweep_sums sums{};
+  for (auto& future : futures)
+  {
+    const auto range_sums = future.get();
+    for (size_t k = 0; k < sums.size(); k++) { sums[k] += range_sums[k]; }
+  }
+  return sums;
+}
+
+template <class F>
+sweep_sums sweep(bfgs& /* b */, VW::sparse_parameters& weights, F&& f)
+{
+  sweep_sums sums{};
+  for (auto w = weights.begin(); w != weights.end(); ++w) { f(&(*w), w.index() >> weights.stride_shift(), sums); }
+  return sums;
+}
+
 template <class T>
 double regularizer_direction_magnitude(VW::workspace& /* all */, bfgs& b, double regularizer, T& weights)
 {
-  double ret = 0.;
   if (b.regularizers == nullptr)
   {
-    for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-    {
-      ret += regularizer * (&(*iter))[W_DIR] * (&(*iter))[W_DIR];
-    }
-  }
-  else
-  {
-    for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-    {
-      ret += ((double)b.regularizers[2 * (iter.index() >> weights.stride_shift())]) * (&(*iter))[W_DIR] *
-          (&(*iter))[W_DIR];
-    }
+    return sweep(b, weights,
+        [regularizer](float* w, uint64_t, sweep_sums& sums) { sums[0] += regularizer * w[W_DIR] * w[W_DIR]; })[0];
   }
-  return ret;
+  const VW::weight* regularizers = b.regularizers;
+  return sweep(b, weights,
+      [regularizers](float* w, uint64_t i, sweep_sums& sums)
+      { sums[0] += (static_cast<double>(regularizers[2 * i])) * w[W_DIR] * w[W_DIR]; })[0];
 }
 
 double regularizer_direction_magnitude(VW::workspace& all, bfgs& b, float regularizer)
@@ -233,43 +282,42 @@ double regularizer_direction_magnitude(VW::workspace& all, bfgs& b, float regula
 }
 
 template <class T>
-float direction_magnitude(VW::workspace& /* all */, T& weights)
+float direction_magnitude(VW::workspace& /* all */, bfgs& b, T& weights)
 {
   // compute direction magnitude
-  double ret = 0.;
-  for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-  {
-    ret += ((double)(&(*iter))[W_DIR]) * (&(*iter))[W_DIR];
-  }
-
+  const double ret = sweep(b, weights,
+      [](float* w, uint64_t, sweep_sums& sums) { sums[0] += (static_cast<double>(w[W_DIR])) * w[W_DIR]; })[0];
   return static_cast<float>(ret);
 }
 
-float direction_magnitude(VW::workspace& all)
+float direction_magnitude(VW::workspace& all, bfgs& b)
 {
   // compute direction magnitude
-  if (all.weights.sparse) { return direction_magnitude(all, all.weights.sparse_weights); }
-  else { return direction_magnitude(all, all.weights.dense_weights); }
+  if (all.weights.sparse) { return direction_magnitude(all, b, all.weights.sparse_weights); }
+  else { return direction_magnitude(all, b, all.weights.dense_weights); }
 }
 
 template <class T>
 void bfgs_iter_start(
     VW::workspace& all, bfgs& b, float* mem, int& lastj, double importance_weight_sum, int& origin, T& weights)
 {
-  double g1_Hg1 = 0.;  // NOLINT
-  double g1_g1 = 0.;
-
   origin = 0;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    if (b.m > 0) { mem1[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT]; }
-    mem1[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
-    g1_Hg1 += ((double)(&(*w))[W_GT]) * ((&(*w))[W_GT]) * ((&(*w))[W_COND]);
-    g1_g1 += ((double)((&(*w))[W_GT])) * ((&(*w))[W_GT]);
-    (&(*w))[W_DIR] = -(&(*w))[W_COND] * ((&(*w))[W_GT]);
-    ((&(*w))[W_GT]) = 0;
-  }
+  const bool store_xt = b.m > 0;
+  float* mem_xt = mem_slot(b, mem, MEM_XT, origin);
+  float* mem_gt = mem_slot(b, mem, MEM_GT, origin);
+  const auto sums = sweep(b, weights,
+      [store_xt, mem_xt, mem_gt](float* w, uint64_t i, sweep_sums& s)
+      {
+        if (store_xt) { mem_xt[i] = w[W_XT]; }
+        mem_gt[i] = w[W_GT];
+        s[0] += (static_cast<double>(w[W_GT])) * w[W_GT] * w[W_COND];
+        s[1] += (static_cast<double>(w[W_GT])) * w[W_GT];
+        w[W_DIR] = -w[W_COND] * w[W_GT];
+        w[W_GT] = 0;
+      });
+  const double g1_Hg1 = sums[0];  // NOLINT
+  const double g1_g1 = sums[1];
+
   lastj = 0;
   if (!all.output_config.quiet)
   {
@@ -291,36 +339,32 @@ template <class T>
 bool bfgs_iter_middle(
     VW::workspace& all, bfgs& b, float* mem, double* rho, double* alpha, int& lastj, int& origin, T& weights)
 {
-  float* mem0 = mem;
   // implement conjugate gradient
   if (b.m == 0)
   {
-    double g_Hy = 0.;  // NOLINT
-    double g_Hg = 0.;  // NOLINT
-    double y = 0.;
-
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      y = (&(*w))[W_GT] - mem[(MEM_GT + origin) % b.mem_stride];
-      g_Hy += ((double)(&(*w))[W_GT]) * ((&(*w))[W_COND]) * y;
-      g_Hg += (static_cast<double>(mem[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_COND]) *
-          mem[(MEM_GT + origin) % b.mem_stride];
-    }
+    float* mem_gt = mem_slot(b, mem, MEM_GT, origin);
+    const auto sums = sweep(b, weights,
+        [mem_gt](float* w, uint64_t i, sweep_sums& s)
+        {
+          const double y = w[W_GT] - mem_gt[i];
+          s[0] += (static_cast<double>(w[W_GT])) * w[W_COND] * y;
+          s[1] += (static_cast<double>(mem_gt[i])) * w[W_COND] * mem_gt[i];
+        });
+    const double g_Hy = sums[0];  // NOLINT
+    const double g_Hg = sums[1];  // NOLINT
 
     float beta = static_cast<float>(g_Hy / g_Hg);
 
     if (beta < 0.f || std::isnan(beta)) { beta = 0.f; }
 
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      mem[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
-
-      (&(*w))[W_DIR] *= beta;
-      (&(*w))[W_DIR] -= ((&(*w))[W_COND]) * ((&(*w))[W_GT]);
-      (&(*w))[W_GT] = 0;
-    }
+    sweep(b, weights,
+        [mem_gt, beta](float* w, uint64_t i, sweep_sums&)
+        {
+          mem_gt[i] = w[W_GT];
+          w[W_DIR] *= beta;
+          w[W_DIR] -= w[W_COND] * w[W_GT];
+          w[W_GT] = 0;
+        });
     if (!all.output_config.quiet) { *(all.output_runtime.trace_message) << fmt::format("{:f}\t", beta); }
     return true;
   }
@@ -330,21 +374,23 @@ bool bfgs_iter_middle(
   }
 
   // implement bfgs
-  double y_s = 0.;
-  double y_Hy = 0.;  // NOLINT
-  double s_q = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    mem1[(MEM_YT + origin) % b.mem_stride] = (&(*w))[W_GT] - mem1[(MEM_GT + origin) % b.mem_stride];
-    mem1[(MEM_ST + origin) % b.mem_stride] = (&(*w))[W_XT] - mem1[(MEM_XT + origin) % b.mem_stride];
-    (&(*w))[W_DIR] = (&(*w))[W_GT];
-    y_s += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) * mem1[(MEM_ST + origin) % b.mem_stride];
-    y_Hy += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) * mem1[(MEM_YT + origin) % b.mem_stride] *
-        ((&(*w))[W_COND]);
-    s_q += (static_cast<double>(mem1[(MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_GT]);
-  }
+  float* mem_yt = mem_slot(b, mem, MEM_YT, origin);
+  float* mem_st = mem_slot(b, mem, MEM_ST, origin);
+  float* mem_gt = mem_slot(b, mem, MEM_GT, origin);
+  float* mem_xt = mem_slot(b, mem, MEM_XT, origin);
+  const auto sums = sweep(b, weights,
+      [mem_yt, mem_st, mem_gt, mem_xt](float* w, uint64_t i, sweep_sums& s)
+      {
+        mem_yt[i] = w[W_GT] - mem_gt[i];
+        mem_st[i] = w[W_XT] - mem_xt[i];
+        w[W_DIR] = w[W_GT];
+        s[0] += (static_cast<double>(mem_yt[i])) * mem_st[i];
+        s[1] += (static_cast<double>(mem_yt[i])) * mem_yt[i] * w[W_COND];
+        s[2] += (static_cast<double>(mem_st[i])) * w[W_GT];
+      });
+  const double y_s = sums[0];
+  const double y_Hy = sums[1];  // NOLINT
+  double s_q = sums[2];
 
   if (y_s <= 0. || y_Hy <= 0.) { return false; }
   rho[0] = 1 / y_s;
@@ -354,46 +400,48 @@ bool bfgs_iter_middle(
   for (int j = 0; j < lastj; j++)
   {
     alpha[j] = rho[j] * s_q;
-    s_q = 0.;
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      (&(*w))[W_DIR] -= static_cast<float>(alpha[j]) * mem[(2 * j + MEM_YT + origin) % b.mem_stride];
-      s_q += (static_cast<double>(mem[(2 * j + 2 + MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    }
+    const auto alpha_j = static_cast<float>(alpha[j]);
+    const float* mem_yt_j = mem_slot(b, mem, 2 * j + MEM_YT, origin);
+    const float* mem_st_next = mem_slot(b, mem, 2 * j + 2 + MEM_ST, origin);
+    s_q = sweep(b, weights,
+        [alpha_j, mem_yt_j, mem_st_next](float* w, uint64_t i, sweep_sums& s)
+        {
+          w[W_DIR] -= alpha_j * mem_yt_j[i];
+          s[0] += (static_cast<double>(mem_st_next[i])) * w[W_DIR];
+        })[0];
   }
 
   alpha[lastj] = rho[lastj] * s_q;
-  double y_r = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    (&(*w))[W_DIR] -= static_cast<float>(alpha[lastj]) * mem[(2 * lastj + MEM_YT + origin) % b.mem_stride];
-    (&(*w))[W_DIR] *= gamma * ((&(*w))[W_COND]);
-    y_r += (static_cast<double>(mem[(2 * lastj + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-  }
+  const auto alpha_last = static_cast<float>(alpha[lastj]);
+  const float* mem_yt_last = mem_slot(b, mem, 2 * lastj + MEM_YT, origin);
+  double y_r = sweep(b, weights,
+      [alpha_last, mem_yt_last, gamma](float* w, uint64_t i, sweep_sums& s)
+      {
+        w[W_DIR] -= alpha_last * mem_yt_last[i];
+        w[W_DIR] *= gamma * w[W_COND];
+        s[0] += (static_cast<double>(mem_yt_last[i])) * w[W_DIR];
+      })[0];
 
   double coef_j;
 
   for (int j = lastj; j > 0; j--)
   {
     coef_j = alpha[j] - rho[j] * y_r;
-    y_r = 0.;
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      (&(*w))[W_DIR] += static_cast<float>(coef_j) * mem[(2 * j + MEM_ST + origin) % b.mem_stride];
-      y_r += (static_cast<double>(mem[(2 * j - 2 + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    }
+    const auto coef = static_cast<float>(coef_j);
+    const float* mem_st_j = mem_slot(b, mem, 2 * j + MEM_ST, origin);
+    const float* mem_yt_previous = mem_slot(b, mem, 2 * j - 2 + MEM_YT, origin);
+    y_r = sweep(b, weights,
+        [coef, mem_st_j, mem_yt_previous](float* w, uint64_t i, sweep_sums& s)
+        {
+          w[W_DIR] += coef * mem_st_j[i];
+          s[0] += (static_cast<double>(mem_yt_previous[i])) * w[W_DIR];
+        })[0];
   }
 
   coef_j = alpha[0] - rho[0] * y_r;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    (&(*w))[W_DIR] = -(&(*w))[W_DIR] - static_cast<float>(coef_j) * mem[(MEM_ST + origin) % b.mem_stride];
-  }
+  const auto coef_0 = static_cast<float>(coef_j);
+  sweep(b, weights,
+      [coef_0, mem_st](float* w, uint64_t i, sweep_sums&) { w[W_DIR] = -w[W_DIR] - coef_0 * mem_st[i]; });
 
   /*********************
   ** shift
@@ -402,13 +450,15 @@ bool bfgs_iter_middle(
   lastj = (lastj < b.m - 1) ? lastj + 1 : b.m - 1;
   origin = (origin + b.mem_stride - 2) % b.mem_stride;
 
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    mem[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
-    mem[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT];
-    (&(*w))[W_GT] = 0;
-  }
+  float* mem_gt_next = mem_slot(b, mem, MEM_GT, origin);
+  float* mem_xt_next = mem_slot(b, mem, MEM_XT, origin);
+  sweep(b, weights,
+      [mem_gt_next, mem_xt_next](float* w, uint64_t i, sweep_sums&)
+      {
+        mem_gt_next[i] = w[W_GT];
+        mem_xt_next[i] = w[W_XT];
+        w[W_GT] = 0;
+      });
   for (int j = lastj; j > 0; j--) { rho[j] = rho[j - 1]; }
   return true;
 }
@@ -426,19 +476,19 @@ template <class T>
 double wolfe_eval(VW::workspace& all, bfgs& b, float* mem, double loss_sum, double previous_loss_sum, double step_size,
     double importance_weight_sum, int& origin, double& wolfe1, T& weights)
 {
-  double g0_d = 0.;
-  double g1_d = 0.;
-  double g1_Hg1 = 0.;  // NOLINT
-  double g1_g1 = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    g0_d += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    g1_d += ((double)(&(*w))[W_GT]) * (&(*w))[W_DIR];
-    g1_Hg1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT] * ((&(*w))[W_COND]);
-    g1_g1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT];
-  }
+  const float* mem_gt = mem_slot(b, mem, MEM_GT, origin);
+  const auto sums = sweep(b, weights,
+      [mem_gt](float* w, uint64_t i, sweep_sums& s)
+      {
+        s[0] += (static_cast<double>(mem_gt[i])) * w[W_DIR];
+        s[1] += (static_cast<double>(w[W_GT])) * w[W_DIR];
+        s[2] += (static_cast<double>(w[W_GT])) * w[W_GT] * w[W_COND];
+        s[3] += (static_cast<double>(w[W_GT])) * w[W_GT];
+      });
+  const double g0_d = sums[0];
+  const double g1_d = sums[1];
+  const double g1_Hg1 = sums[2];  // NOLINT
+  const double g1_g1 = sums[3];
 
   wolfe1 = (loss_sum - previous_loss_sum) / (step_size * g0_d);
   double wolfe2 = g1_d / g0_d;
@@ -625,13 +675,9 @@ void zero_state(VW::workspace& all)
 template <class T>
 double derivative_in_direction(VW::workspace& /* all */, bfgs& b, float* mem, int& origin, T& weights)
 {
-  double ret = 0.;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    ret += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * (&(*w))[W_DIR];
-  }
-  return ret;
+  const float* mem_gt = mem_slot(b, mem, MEM_GT, origin);
+  return sweep(b, weights,
+      [mem_gt](float* w, uint64_t i, sweep_sums& s) { s[0] += (static_cast<double>(mem_gt[i])) * w[W_DIR]; })[0];
 }
 
 double derivative_in_direction(VW::workspace& all, bfgs& b, float* mem, int& origin)
@@ -697,7 +743,7 @@ int process_pass(VW::workspace& all, bfgs& b)
     else
     {
       b.step_size = 0.5;
-      float d_mag = direction_magnitude(all);
+      float d_mag = direction_magnitude(all, b);
       b.t_end_global = std::chrono::system_clock::now();
       b.net_time = static_cast<double>(
           std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
@@ -816,7 +862,7 @@ int process_pass(VW::workspace& all, bfgs& b)
         }
         else
         {
-          float d_mag = direction_magnitude(all);
+          float d_mag = direction_magnitude(all, b);
           b.t_end_global = std::chrono::system_clock::now();
           b.net_time = static_cast<double>(
               std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
@@ -859,7 +905,7 @@ int process_pass(VW::workspace& all, bfgs& b)
       }
       else { b.step_size = -dd / static_cast<float>(b.curvature); }
 
-      float d_mag = direction_magnitude(all);
+      float d_mag = direction_magnitude(all, b);
 
       b.predictions.clear();
       update_weight(all, b.step_size);
@@ -1075,6 +1121,7 @@ void save_load(bfgs& b, VW::io_buf& model_file, bool read, bool text)
     int m = b.m;
 
     b.mem_stride = (m == 0) ? CG_EXTRA : 2 * m;
+    b.mem_length = all->length();
     b.mem = VW::details::calloc_or_throw<float>(all->length() * b.mem_stride);
     b.rho = VW::details::calloc_or_throw<double>(m);
     b.alpha = VW::details::calloc_or_throw<double>(m);
@@ -1149,6 +1196,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
   int local_m = 0;
   float local_rel_threshold = 0.f;
   bool local_hessian_on = false;
+  uint64_t local_threads = 1;
   option_group_definition bfgs_options("[Reduction] LBFGS and Conjugate Gradient");
   bfgs_options.add(
       make_option("bfgs", bfgs_option).keep().necessary().help("Use conjugate gradient based optimization"));
@@ -1156,6 +1204,12 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
   bfgs_options.add(
       make_option("mem", local_m).default_value(15).help("Number of stored corrections for L-BFGS optimization"));
   bfgs_options.add(make_option("termination", local_rel_threshold).default_value(0.001f).help("Termination threshold"));
+  bfgs_options.add(make_option("bfgs_threads", local_threads)
+                       .default_value(1)
+                       .experimental()
+                       .help("Number of threads for the passes over dense weights which compute the search direction "
+                             "and line search terms. Sums are split by thread, so results can differ slightly with "
+                             "the number of threads"));
 
   auto conjugate_gradient_enabled = options.add_parse_and_check_necessary(conjugate_gradient_options);
   auto bfgs_enabled = options.add_parse_and_check_necessary(bfgs_options);
@@ -1187,6 +1241,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
 
   if (b->m == 0) { b->hessian_on = true; }
 
+  if (local_threads == 0) { THROW("bfgs_threads should be positive") }
+  if (local_threads > 1) { b->threads = VW::make_unique<VW::thread_pool>(local_threads); }
+
   if (!all.output_config.quiet)
   {
     if (b->m > 0) { *(all.output_runtime.trace_message) << "enabling BFGS based optimization "; }
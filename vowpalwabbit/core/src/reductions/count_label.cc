@@ -36,6 +36,13 @@ void count_label_single(reduction_data& data, VW::LEARNER::learner& base, VW::ex
   else { base.predict(ec); }
 }
 
+void count_label_batch(reduction_data& data, VW::LEARNER::learner& base, VW::example* const* examples, size_t count)
+{
+  VW::shared_data* sd = data.all->sd.get();
+  for (size_t k = 0; k < count; k++) { VW::count_label(*sd, examples[k]->l.simple.label); }
+  base.predict_batch(examples, count);
+}
+
 template <bool is_learn>
 void count_label_multi(reduction_data& data, VW::LEARNER::learner& base, VW::multi_ex& ec_seq)
 {
@@ -97,6 +104,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::count_label_setup(VW::setu
                      .set_output_prediction_type(base->get_output_prediction_type())
                      .set_input_label_type(label_type_t::SIMPLE)
                      .set_output_label_type(label_type_t::SIMPLE)
+                     .set_predict_batch(count_label_batch)
                      .build();
   return learner;
 }
@@ -7,6 +7,14 @@
 #include "vw/common/vw_exception.h"
 #include "vw/core/estimators/confidence_sequence_robust.h"
 #include "vw/core/multi_model_utils.h"
+#include "vw/core/reductions/cb/cb_adf.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/vw.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
 
 /*
 This reduction implements the ChaCha algorithm from page 5 of the following paper:
@@ -63,7 +71,7 @@ namespace automl
 template <typename config_oracle_impl, typename estimator_impl>
 interaction_config_manager<config_oracle_impl, estimator_impl>::interaction_config_manager(uint64_t default_lease,
     uint64_t max_live_configs, std::shared_ptr<VW::rand_state> rand_state, uint64_t priority_challengers,
-    const std::string& interaction_type, const std::string& oracle_type, dense_parameters& weights,
+    const std::string& interaction_type, const std::string& oracle_type, VW::parameters& weights,
     priority_func calc_priority, double automl_significance_level, VW::io::logger* logger, uint32_t& feature_width,
     bool ccb_on, config_type conf_type, std::string trace_prefix, bool reward_as_cost, double tol_x, bool is_brentq)
     : default_lease(default_lease)
@@ -418,19 +426,32 @@ void automl<CMType>::offset_learn(LEARNER::learner& base, multi_ex& ec, VW::cb_c
         for (example* ex : ec) { ex->interactions = incoming_interactions; }
       });
 
-  // Learn and update estimators of challengers
-  for (int64_t current_slot_index = 1; static_cast<size_t>(current_slot_index) < cm->estimators.size();
-       ++current_slot_index)
+  if (threads != nullptr && cm->estimators.size() > 1 && !ec.empty())
   {
-    if (!debug_reverse_learning_order) { live_slot = current_slot_index; }
-    else { live_slot = cm->estimators.size() - current_slot_index; }
-    cm->do_learning(base, ec, live_slot);
-    cm->estimators[live_slot].first._estimator.update(ec[0]->pred.a_s[0].action == labelled_action ? w : 0, r);
+    concurrent_learn(base, ec);
+    for (live_slot = 1; static_cast<size_t>(live_slot) < cm->estimators.size(); ++live_slot)
+    {
+      const auto& slot_ec = slot_exs[live_slot - 1];
+      cm->estimators[live_slot].first._estimator.update(
+          slot_ec[0]->pred.a_s[0].action == labelled_action ? w : 0, r);
+    }
   }
+  else
+  {
+    // Learn and update estimators of challengers
+    for (int64_t current_slot_index = 1; static_cast<size_t>(current_slot_index) < cm->estimators.size();
+         ++current_slot_index)
+    {
+      if (!debug_reverse_learning_order) { live_slot = current_slot_index; }
+      else { live_slot = cm->estimators.size() - current_slot_index; }
+      cm->do_learning(base, ec, live_slot);
+      cm->estimators[live_slot].first._estimator.update(ec[0]->pred.a_s[0].action == labelled_action ? w : 0, r);
+    }
 
-  // ** Note: champ learning is done after to ensure correct feature count in gd **
-  // Learn and get action of champ
-  cm->do_learning(base, ec, current_champ);
+    // ** Note: champ learning is done after to ensure correct feature count in gd **
+    // Learn and get action of champ
+    cm->do_learning(base, ec, current_champ);
+  }
 
   if (ec.size() < 1) { return; }
 
@@ -447,6 +468,127 @@ void automl<CMType>::offset_learn(LEARNER::learner& base, multi_ex& ec, VW::cb_c
   }
 }
 
+namespace
+{
+per_model_learners find_per_model_learners(VW::workspace& all)
+{
+  per_model_learners learners;
+  for (auto* l = all.l.get(); l != nullptr; l = l->get_base_learner())
+  {
+    void* data = l->get_internal_type_erased_data_pointer_test_use_only();
+    if (l->get_name() == "gd") { learners.gd = static_cast<VW::reductions::gd*>(data); }
+    else if (l->get_name() == "cb_adf") { learners.cb_adf = static_cast<VW::reductions::cb_adf*>(data); }
+  }
+  return learners;
+}
+
+// Copies the states of every model learned through live_slot. slot_width is the number of models below automl.
+template <typename StateT>
+void copy_slot(
+    const std::vector<StateT>& from, std::vector<StateT>& to, uint64_t live_slot, size_t slot_width, size_t num_slots)
+{
+  for (size_t begin = live_slot * slot_width; begin < from.size(); begin += slot_width * num_slots)
+  {
+    const size_t end = std::min(begin + slot_width, from.size());
+    std::copy(from.begin() + begin, from.begin() + end, to.begin() + begin);
+  }
+}
+
+void copy_slot(const per_model_learners& from, const per_model_learners& to, uint64_t live_slot, size_t slot_width,
+    size_t num_slots)
+{
+  if (from.gd != nullptr)
+  {
+    copy_slot(from.gd->gd_per_model_states, to.gd->gd_per_model_states, live_slot, slot_width, num_slots);
+  }
+  if (from.cb_adf != nullptr)
+  {
+    copy_slot(from.cb_adf->get_gen_cs_mtr().per_model_state, to.cb_adf->get_gen_cs_mtr().per_model_state, live_slot,
+        slot_width, num_slots);
+  }
+}
+}  // namespace
+
+template <typename CMType>
+void automl<CMType>::concurrent_learn(LEARNER::learner& base, multi_ex& ec)
+{
+  const size_t challengers = cm->estimators.size() - 1;
+  if (all->weights.sparse && !all->weights.sparse_weights.concurrent_inserts())
+  {
+    // The replicas insert their new weights into the table they share with all. Enough shards are used that threads
+    // rarely wait for each other's inserts.
+    size_t num_shards = 1;
+    while (num_shards < 16 * cm->max_live_configs) { num_shards *= 2; }
+    all->weights.sparse_weights.enable_concurrent_inserts(num_shards);
+  }
+  if (replicas.empty()) { all_learners = find_per_model_learners(*all); }
+  while (replicas.size() < challengers)
+  {
+    // The replica's own automl is never called, its challengers learn through the learner below it.
+    replicas.push_back(VW::details::create_replica(*all, {"automl_threads", "csv_trace"}));
+    replica_bases.push_back(replicas.back()->l->get_learner_by_name_prefix("automl")->get_base_learner());
+    replica_learners.push_back(find_per_model_learners(*replicas.back()));
+    slot_examples.emplace_back();
+    slot_exs.emplace_back();
+  }
+
+  const size_t slot_width = base.feature_width_below / all->weights.stride();
+  std::vector<std::future<void>> futures;
+  futures.reserve(challengers);
+  // The slot tasks use this, replica_bases and slot_exs, so every submitted task is waited on before an error from
+  // the champ or any slot propagates.
+  std::exception_ptr error;
+  try
+  {
+    for (uint64_t live_slot = 1; live_slot <= challengers; ++live_slot)
+    {
+      auto& replica = *replicas[live_slot - 1];
+      replica.update_rule_config.eta = all->update_rule_config.eta;
+      replica.passes_config.current_pass = all->passes_config.current_pass;
+
+      // ec is copied before any slot learns since learning changes its interactions, labels and predictions.
+      auto& copies = slot_examples[live_slot - 1];
+      while (copies.size() < ec.size()) { copies.push_back(VW::make_unique<VW::example>()); }
+      auto& slot_ec = slot_exs[live_slot - 1];
+      slot_ec.clear();
+      for (size_t i = 0; i < ec.size(); i++)
+      {
+        VW::copy_example_data_with_label(copies[i].get(), ec[i]);
+        slot_ec.push_back(copies[i].get());
+      }
+
+      copy_slot(all_learners, replica_learners[live_slot - 1], live_slot, slot_width, cm->max_live_configs);
+
+      futures.push_back(threads->submit(
+          [this, live_slot]() { cm->do_learning(*replica_bases[live_slot - 1], slot_exs[live_slot - 1], live_slot); }));
+    }
+
+    // ** Note: champ learning is done on ec itself to ensure correct feature count in gd **
+    cm->do_learning(base, ec, cm->current_champ);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  for (auto& future : futures)
+  {
+    try
+    {
+      future.get();
+    }
+    catch (...)
+    {
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+
+  for (uint64_t live_slot = 1; live_slot <= challengers; ++live_slot)
+  {
+    copy_slot(replica_learners[live_slot - 1], all_learners, live_slot, slot_width, cm->max_live_configs);
+  }
+}
+
 template class automl<
     interaction_config_manager<config_oracle<oracle_rand_impl>, VW::estimators::confidence_sequence_robust>>;
 template class automl<
@@ -0,0 +1,58 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+// Note: SIMD support is currently Linux/x86 only (GCC/Clang). MSVC and non-x86
+// architectures (e.g. via SIMDe) are not yet supported.
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+
+#  include "vw/core/array_parameters_dense.h"
+#  include "vw/core/feature_group.h"
+
+#  include <cstddef>
+#  include <cstdint>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+inline bool cpu_supports_gd_avx2() { return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"); }
+
+inline bool cpu_supports_gd_avx512()
+{
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+      __builtin_cpu_supports("avx512vl");
+}
+
+// The kernels below cover the linear terms of one namespace against dense weights. They visit the features of fs in
+// order and compute exactly the same per-weight state as the scalar gd path. Only the accumulated sums (prediction,
+// pred_per_update and norm_x) are reordered, so they can differ from the scalar path in the last bits.
+
+// Returns the sum of weight * value over fs, 8 features at a time.
+float linear_predict_avx2(const VW::dense_parameters& weights, const VW::features& fs, uint64_t offset);
+// Returns the sum of weight * value over fs, 16 features at a time.
+float linear_predict_avx512(const VW::dense_parameters& weights, const VW::features& fs, uint64_t offset);
+
+// Applies the gd weight update (w[0] += update * x * w[spare]) for every feature in fs. Assumes feature_mask is off.
+void linear_update_avx2(
+    VW::dense_parameters& weights, const VW::features& fs, uint64_t offset, float update, size_t spare);
+void linear_update_avx512(
+    VW::dense_parameters& weights, const VW::features& fs, uint64_t offset, float update, size_t spare);
+
+// Updates the adaptive/normalized state of every feature in fs and accumulates into pred_per_update and norm_x, as
+// pred_per_update_feature does with sqrt_rate, feature_mask off and stateless off. A component index of 0 means that
+// component is not present. Returns true if a feature had too much magnitude.
+bool linear_pred_per_update_avx2(VW::dense_parameters& weights, const VW::features& fs, uint64_t offset,
+    float grad_squared, size_t adaptive, size_t normalized, size_t spare, float& pred_per_update, float& norm_x);
+bool linear_pred_per_update_avx512(VW::dense_parameters& weights, const VW::features& fs, uint64_t offset,
+    float grad_squared, size_t adaptive, size_t normalized, size_t spare, float& pred_per_update, float& norm_x);
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
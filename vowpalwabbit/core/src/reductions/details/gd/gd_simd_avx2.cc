@@ -0,0 +1,244 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+
+#  include "gd_simd.h"
+#  include "gd_simd_kernel_impl.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+namespace
+{
+// https://stackoverflow.com/questions/23189488/horizontal-sum-of-32-bit-floats-in-256-bit-avx-vector
+inline float horizontal_sum(const __m256& x)
+{
+  const __m128 x128 = _mm_add_ps(_mm256_extractf128_ps(x, 1), _mm256_castps256_ps128(x));
+  const __m128 x64 = _mm_add_ps(x128, _mm_movehl_ps(x128, x128));
+  const __m128 x32 = _mm_add_ss(x64, _mm_shuffle_ps(x64, x64, 0x55));
+  return _mm_cvtss_f32(x32);
+}
+
+// Loads the weight indices of features j..j+7, already offset and masked.
+inline void load_indices8(const VW::features& fs, size_t j, const __m256i& offsets, const __m256i& weights_masks,
+    __m256i& indices1, __m256i& indices2)
+{
+  indices1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&fs.indices[j]));
+  indices2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&fs.indices[j + 4]));
+  indices1 = _mm256_and_si256(_mm256_add_epi64(indices1, offsets), weights_masks);
+  indices2 = _mm256_and_si256(_mm256_add_epi64(indices2, offsets), weights_masks);
+}
+
+// AVX2 only gathers 4 floats with 64-bit indices, so two gathers make up 8 weights.
+inline __m256 gather8(const float* base, const __m256i& indices1, const __m256i& indices2)
+{
+  const __m128 lo = _mm256_i64gather_ps(base, indices1, 4);
+  const __m128 hi = _mm256_i64gather_ps(base, indices2, 4);
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+// AVX2 has no scatter, the lanes selected by lane_mask are stored one by one.
+inline void scatter8(float* base, const uint64_t* indices, const __m256& values, int lane_mask)
+{
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, values);
+  for (int k = 0; k < 8; ++k)
+  {
+    if (lane_mask & (1 << k)) { base[indices[k]] = lanes[k]; }
+  }
+}
+
+inline __m256 inv_sqrt8(const __m256& x)
+{
+#  ifdef STD_INV_SQRT
+  return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(x));
+#  else
+  return _mm256_rsqrt_ps(x);
+#  endif
+}
+}  // namespace
+
+float linear_predict_avx2(const VW::dense_parameters& weights, const VW::features& fs, uint64_t offset)
+{
+  const float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const __m256i offsets = _mm256_set1_epi64x(offset);
+  const __m256i weights_masks = _mm256_set1_epi64x(weights_mask);
+
+  __m256 sums = _mm256_setzero_ps();
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 8 <= num_features; j += 8)
+  {
+    __m256i indices1;
+    __m256i indices2;
+    load_indices8(fs, j, offsets, weights_masks, indices1, indices2);
+    const __m256 values = _mm256_loadu_ps(&fs.values[j]);
+    sums = _mm256_fmadd_ps(gather8(w, indices1, indices2), values, sums);
+  }
+
+  float sum = horizontal_sum(sums);
+  // Handle tail of the loop using scalar implementation.
+  for (; j < num_features; ++j) { sum += w[(fs.indices[j] + offset) & weights_mask] * fs.values[j]; }
+  return sum;
+}
+
+void linear_update_avx2(
+    VW::dense_parameters& weights, const VW::features& fs, uint64_t offset, float update, size_t spare)
+{
+  float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const __m256i offsets = _mm256_set1_epi64x(offset);
+  const __m256i weights_masks = _mm256_set1_epi64x(weights_mask);
+  const __m256 updates = _mm256_set1_ps(update);
+  const __m256 flt_max = _mm256_set1_ps(FLT_MAX);
+  const __m256 neg_flt_max = _mm256_set1_ps(-FLT_MAX);
+
+  alignas(32) uint64_t indices[8];
+  alignas(32) float deltas[8];
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 8 <= num_features; j += 8)
+  {
+    __m256i indices1;
+    __m256i indices2;
+    load_indices8(fs, j, offsets, weights_masks, indices1, indices2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), indices1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices + 4), indices2);
+
+    __m256 x = _mm256_loadu_ps(&fs.values[j]);
+    const int modify = _mm256_movemask_ps(
+        _mm256_and_ps(_mm256_cmp_ps(x, flt_max, _CMP_LT_OQ), _mm256_cmp_ps(x, neg_flt_max, _CMP_GT_OQ)));
+    if (spare != 0) { x = _mm256_mul_ps(x, gather8(w + spare, indices1, indices2)); }
+    _mm256_store_ps(deltas, _mm256_mul_ps(updates, x));
+
+    // The adds stay scalar and in feature order, so repeated indices accumulate exactly as in the scalar path.
+    for (int k = 0; k < 8; ++k)
+    {
+      if (modify & (1 << k)) { w[indices[k]] += deltas[k]; }
+    }
+  }
+
+  for (; j < num_features; ++j)
+  {
+    update_kernel_impl(&w[(fs.indices[j] + offset) & weights_mask], fs.values[j], update, spare);
+  }
+}
+
+bool linear_pred_per_update_avx2(VW::dense_parameters& weights, const VW::features& fs, uint64_t offset,
+    float grad_squared, size_t adaptive, size_t normalized, size_t spare, float& pred_per_update, float& norm_x)
+{
+  float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const uint32_t stride_shift = weights.stride_shift();
+  const __m256i offsets = _mm256_set1_epi64x(offset);
+  const __m256i weights_masks = _mm256_set1_epi64x(weights_mask);
+  const __m256 grad_squareds = _mm256_set1_ps(grad_squared);
+  const __m256 zeros = _mm256_setzero_ps();
+  const __m256 ones = _mm256_set1_ps(1.f);
+  const __m256 x_mins = _mm256_set1_ps(GD_SIMD_X_MIN);
+  const __m256 neg_x_mins = _mm256_set1_ps(-GD_SIMD_X_MIN);
+  const __m256 x2_mins = _mm256_set1_ps(GD_SIMD_X2_MIN);
+  const __m256 x2_maxs = _mm256_set1_ps(GD_SIMD_X2_MAX);
+  const __m256 sign_mask = _mm256_set1_ps(-0.f);
+
+  __m256 pred_per_update_sums = _mm256_setzero_ps();
+  __m256 norm_x_sums = _mm256_setzero_ps();
+  bool overflow = false;
+
+  alignas(32) uint64_t indices[8];
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 8 <= num_features; j += 8)
+  {
+    __m256i indices1;
+    __m256i indices2;
+    load_indices8(fs, j, offsets, weights_masks, indices1, indices2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), indices1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices + 4), indices2);
+
+    if (has_conflict(indices, 8, stride_shift))
+    {
+      for (size_t k = 0; k < 8; ++k)
+      {
+        overflow |= pred_per_update_kernel_impl(&w[indices[k]], fs.values[j + k], grad_squared, adaptive, normalized,
+            spare, pred_per_update, norm_x);
+      }
+      continue;
+    }
+
+    __m256 x = _mm256_loadu_ps(&fs.values[j]);
+    __m256 x2 = _mm256_mul_ps(x, x);
+    const __m256 tiny = _mm256_cmp_ps(x2, x2_mins, _CMP_LT_OQ);
+    x = _mm256_blendv_ps(x, _mm256_blendv_ps(neg_x_mins, x_mins, _mm256_cmp_ps(x, zeros, _CMP_GT_OQ)), tiny);
+    x2 = _mm256_blendv_ps(x2, x2_mins, tiny);
+
+    __m256 rate_decay = ones;
+    if (adaptive != 0)
+    {
+      __m256 w_adaptive = gather8(w + adaptive, indices1, indices2);
+      w_adaptive = _mm256_add_ps(w_adaptive, _mm256_mul_ps(grad_squareds, x2));
+      scatter8(w + adaptive, indices, w_adaptive, 0xff);
+      rate_decay = inv_sqrt8(w_adaptive);
+    }
+    if (normalized != 0)
+    {
+      __m256 w_normalized = gather8(w + normalized, indices1, indices2);
+      const __m256 x_abs = _mm256_andnot_ps(sign_mask, x);
+      const __m256 new_scale = _mm256_cmp_ps(x_abs, w_normalized, _CMP_GT_OQ);
+      const int new_scale_lanes = _mm256_movemask_ps(new_scale);
+      if (new_scale_lanes != 0)
+      {
+        // Rescale the weight so it's as if the new scale was the old scale.
+        const int rescale_lanes =
+            _mm256_movemask_ps(_mm256_and_ps(new_scale, _mm256_cmp_ps(w_normalized, zeros, _CMP_GT_OQ)));
+        if (rescale_lanes != 0)
+        {
+          __m256 rescale = _mm256_div_ps(w_normalized, x_abs);
+          if (adaptive == 0) { rescale = _mm256_mul_ps(rescale, rescale); }
+          scatter8(w, indices, _mm256_mul_ps(gather8(w, indices1, indices2), rescale), rescale_lanes);
+        }
+        w_normalized = _mm256_blendv_ps(w_normalized, x_abs, new_scale);
+        scatter8(w + normalized, indices, w_normalized, new_scale_lanes);
+      }
+
+      __m256 norm_x2 = _mm256_div_ps(x2, _mm256_mul_ps(w_normalized, w_normalized));
+      const __m256 too_large = _mm256_cmp_ps(x2, x2_maxs, _CMP_GT_OQ);
+      if (_mm256_movemask_ps(too_large) != 0)
+      {
+        norm_x2 = _mm256_blendv_ps(norm_x2, ones, too_large);
+        overflow = true;
+      }
+      norm_x_sums = _mm256_add_ps(norm_x_sums, norm_x2);
+
+      const __m256 inv_norm = _mm256_div_ps(ones, w_normalized);
+      if (adaptive != 0) { rate_decay = _mm256_mul_ps(rate_decay, inv_norm); }
+      else { rate_decay = _mm256_mul_ps(rate_decay, _mm256_mul_ps(inv_norm, inv_norm)); }
+    }
+
+    scatter8(w + spare, indices, rate_decay, 0xff);
+    pred_per_update_sums = _mm256_add_ps(pred_per_update_sums, _mm256_mul_ps(x2, rate_decay));
+  }
+
+  pred_per_update += horizontal_sum(pred_per_update_sums);
+  norm_x += horizontal_sum(norm_x_sums);
+  for (; j < num_features; ++j)
+  {
+    overflow |= pred_per_update_kernel_impl(&w[(fs.indices[j] + offset) & weights_mask], fs.values[j], grad_squared,
+        adaptive, normalized, spare, pred_per_update, norm_x);
+  }
+  return overflow;
+}
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
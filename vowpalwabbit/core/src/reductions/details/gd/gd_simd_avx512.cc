@@ -0,0 +1,223 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+
+#  include "gd_simd.h"
+#  include "gd_simd_kernel_impl.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+namespace
+{
+// https://stackoverflow.com/questions/23189488/horizontal-sum-of-32-bit-floats-in-256-bit-avx-vector
+inline float horizontal_sum(const __m256& x)
+{
+  const __m128 x128 = _mm_add_ps(_mm256_extractf128_ps(x, 1), _mm256_castps256_ps128(x));
+  const __m128 x64 = _mm_add_ps(x128, _mm_movehl_ps(x128, x128));
+  const __m128 x32 = _mm_add_ss(x64, _mm_shuffle_ps(x64, x64, 0x55));
+  return _mm_cvtss_f32(x32);
+}
+
+// Loads the weight indices of features j..j+7, already offset and masked.
+inline __m512i load_indices8(const VW::features& fs, size_t j, const __m512i& offsets, const __m512i& weights_masks)
+{
+  const __m512i indices = _mm512_loadu_si512(&fs.indices[j]);
+  return _mm512_and_epi64(_mm512_add_epi64(indices, offsets), weights_masks);
+}
+
+// True if two lanes address the same weight block, see has_conflict().
+inline bool has_conflict8(const __m512i& indices, uint32_t stride_shift)
+{
+  const __m512i blocks = _mm512_srli_epi64(indices, stride_shift);
+  return _mm512_test_epi64_mask(_mm512_conflict_epi64(blocks), _mm512_conflict_epi64(blocks)) != 0;
+}
+
+inline __m256 inv_sqrt8(const __m256& x)
+{
+#  ifdef STD_INV_SQRT
+  return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(x));
+#  else
+  // rsqrt14 is more precise than rsqrtss and so would not match the scalar path.
+  return _mm256_rsqrt_ps(x);
+#  endif
+}
+}  // namespace
+
+float linear_predict_avx512(const VW::dense_parameters& weights, const VW::features& fs, uint64_t offset)
+{
+  const float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const __m512i offsets = _mm512_set1_epi64(offset);
+  const __m512i weights_masks = _mm512_set1_epi64(weights_mask);
+
+  // 64-bit indices gather 8 floats at a time, so two independent accumulators keep 16 features in flight.
+  __m256 sums1 = _mm256_setzero_ps();
+  __m256 sums2 = _mm256_setzero_ps();
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 16 <= num_features; j += 16)
+  {
+    const __m256 weights1 = _mm512_i64gather_ps(load_indices8(fs, j, offsets, weights_masks), w, 4);
+    const __m256 weights2 = _mm512_i64gather_ps(load_indices8(fs, j + 8, offsets, weights_masks), w, 4);
+    sums1 = _mm256_fmadd_ps(weights1, _mm256_loadu_ps(&fs.values[j]), sums1);
+    sums2 = _mm256_fmadd_ps(weights2, _mm256_loadu_ps(&fs.values[j + 8]), sums2);
+  }
+
+  float sum = horizontal_sum(_mm256_add_ps(sums1, sums2));
+  // Handle tail of the loop using scalar implementation.
+  for (; j < num_features; ++j) { sum += w[(fs.indices[j] + offset) & weights_mask] * fs.values[j]; }
+  return sum;
+}
+
+void linear_update_avx512(
+    VW::dense_parameters& weights, const VW::features& fs, uint64_t offset, float update, size_t spare)
+{
+  float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const uint32_t stride_shift = weights.stride_shift();
+  const __m512i offsets = _mm512_set1_epi64(offset);
+  const __m512i weights_masks = _mm512_set1_epi64(weights_mask);
+  const __m256 updates = _mm256_set1_ps(update);
+  const __m256 flt_max = _mm256_set1_ps(FLT_MAX);
+  const __m256 neg_flt_max = _mm256_set1_ps(-FLT_MAX);
+
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 8 <= num_features; j += 8)
+  {
+    const __m512i indices = load_indices8(fs, j, offsets, weights_masks);
+    if (has_conflict8(indices, stride_shift))
+    {
+      for (size_t k = j; k < j + 8; ++k)
+      {
+        update_kernel_impl(&w[(fs.indices[k] + offset) & weights_mask], fs.values[k], update, spare);
+      }
+      continue;
+    }
+
+    __m256 x = _mm256_loadu_ps(&fs.values[j]);
+    const __mmask8 modify =
+        _mm256_cmp_ps_mask(x, flt_max, _CMP_LT_OQ) & _mm256_cmp_ps_mask(x, neg_flt_max, _CMP_GT_OQ);
+    if (spare != 0) { x = _mm256_mul_ps(x, _mm512_i64gather_ps(indices, w + spare, 4)); }
+    const __m256 updated = _mm256_add_ps(_mm512_i64gather_ps(indices, w, 4), _mm256_mul_ps(updates, x));
+    _mm512_mask_i64scatter_ps(w, modify, indices, updated, 4);
+  }
+
+  for (; j < num_features; ++j)
+  {
+    update_kernel_impl(&w[(fs.indices[j] + offset) & weights_mask], fs.values[j], update, spare);
+  }
+}
+
+bool linear_pred_per_update_avx512(VW::dense_parameters& weights, const VW::features& fs, uint64_t offset,
+    float grad_squared, size_t adaptive, size_t normalized, size_t spare, float& pred_per_update, float& norm_x)
+{
+  float* w = weights.data();
+  const uint64_t weights_mask = weights.mask();
+  const uint32_t stride_shift = weights.stride_shift();
+  const __m512i offsets = _mm512_set1_epi64(offset);
+  const __m512i weights_masks = _mm512_set1_epi64(weights_mask);
+  const __m256 grad_squareds = _mm256_set1_ps(grad_squared);
+  const __m256 zeros = _mm256_setzero_ps();
+  const __m256 ones = _mm256_set1_ps(1.f);
+  const __m256 x_mins = _mm256_set1_ps(GD_SIMD_X_MIN);
+  const __m256 neg_x_mins = _mm256_set1_ps(-GD_SIMD_X_MIN);
+  const __m256 x2_mins = _mm256_set1_ps(GD_SIMD_X2_MIN);
+  const __m256 x2_maxs = _mm256_set1_ps(GD_SIMD_X2_MAX);
+  const __m256 sign_mask = _mm256_set1_ps(-0.f);
+
+  __m256 pred_per_update_sums = _mm256_setzero_ps();
+  __m256 norm_x_sums = _mm256_setzero_ps();
+  bool overflow = false;
+
+  const size_t num_features = fs.size();
+  size_t j = 0;
+  for (; j + 8 <= num_features; j += 8)
+  {
+    const __m512i indices = load_indices8(fs, j, offsets, weights_masks);
+    if (has_conflict8(indices, stride_shift))
+    {
+      for (size_t k = j; k < j + 8; ++k)
+      {
+        overflow |= pred_per_update_kernel_impl(&w[(fs.indices[k] + offset) & weights_mask], fs.values[k],
+            grad_squared, adaptive, normalized, spare, pred_per_update, norm_x);
+      }
+      continue;
+    }
+
+    __m256 x = _mm256_loadu_ps(&fs.values[j]);
+    __m256 x2 = _mm256_mul_ps(x, x);
+    const __mmask8 tiny = _mm256_cmp_ps_mask(x2, x2_mins, _CMP_LT_OQ);
+    const __mmask8 positive = _mm256_cmp_ps_mask(x, zeros, _CMP_GT_OQ);
+    x = _mm256_mask_blend_ps(tiny, x, _mm256_mask_blend_ps(positive, neg_x_mins, x_mins));
+    x2 = _mm256_mask_blend_ps(tiny, x2, x2_mins);
+
+    __m256 rate_decay = ones;
+    if (adaptive != 0)
+    {
+      __m256 w_adaptive = _mm512_i64gather_ps(indices, w + adaptive, 4);
+      w_adaptive = _mm256_add_ps(w_adaptive, _mm256_mul_ps(grad_squareds, x2));
+      _mm512_i64scatter_ps(w + adaptive, indices, w_adaptive, 4);
+      rate_decay = inv_sqrt8(w_adaptive);
+    }
+    if (normalized != 0)
+    {
+      __m256 w_normalized = _mm512_i64gather_ps(indices, w + normalized, 4);
+      const __m256 x_abs = _mm256_andnot_ps(sign_mask, x);
+      const __mmask8 new_scale = _mm256_cmp_ps_mask(x_abs, w_normalized, _CMP_GT_OQ);
+      if (new_scale != 0)
+      {
+        // Rescale the weight so it's as if the new scale was the old scale.
+        const __mmask8 rescale_lanes = new_scale & _mm256_cmp_ps_mask(w_normalized, zeros, _CMP_GT_OQ);
+        if (rescale_lanes != 0)
+        {
+          __m256 rescale = _mm256_div_ps(w_normalized, x_abs);
+          if (adaptive == 0) { rescale = _mm256_mul_ps(rescale, rescale); }
+          const __m256 rescaled = _mm256_mul_ps(_mm512_i64gather_ps(indices, w, 4), rescale);
+          _mm512_mask_i64scatter_ps(w, rescale_lanes, indices, rescaled, 4);
+        }
+        w_normalized = _mm256_mask_blend_ps(new_scale, w_normalized, x_abs);
+        _mm512_mask_i64scatter_ps(w + normalized, new_scale, indices, w_normalized, 4);
+      }
+
+      __m256 norm_x2 = _mm256_div_ps(x2, _mm256_mul_ps(w_normalized, w_normalized));
+      const __mmask8 too_large = _mm256_cmp_ps_mask(x2, x2_maxs, _CMP_GT_OQ);
+      if (too_large != 0)
+      {
+        norm_x2 = _mm256_mask_blend_ps(too_large, norm_x2, ones);
+        overflow = true;
+      }
+      norm_x_sums = _mm256_add_ps(norm_x_sums, norm_x2);
+
+      const __m256 inv_norm = _mm256_div_ps(ones, w_normalized);
+      if (adaptive != 0) { rate_decay = _mm256_mul_ps(rate_decay, inv_norm); }
+      else { rate_decay = _mm256_mul_ps(rate_decay, _mm256_mul_ps(inv_norm, inv_norm)); }
+    }
+
+    _mm512_i64scatter_ps(w + spare, indices, rate_decay, 4);
+    pred_per_update_sums = _mm256_add_ps(pred_per_update_sums, _mm256_mul_ps(x2, rate_decay));
+  }
+
+  pred_per_update += horizontal_sum(pred_per_update_sums);
+  norm_x += horizontal_sum(norm_x_sums);
+  for (; j < num_features; ++j)
+  {
+    overflow |= pred_per_update_kernel_impl(&w[(fs.indices[j] + offset) & weights_mask], fs.values[j], grad_squared,
+        adaptive, normalized, spare, pred_per_update, norm_x);
+  }
+  return overflow;
+}
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
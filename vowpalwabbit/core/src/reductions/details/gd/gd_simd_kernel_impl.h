@@ -0,0 +1,106 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <x86intrin.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+// These must be the same as the constants used by pred_per_update_feature in gd.cc.
+constexpr float GD_SIMD_X_MIN = 1.084202e-19f;
+constexpr float GD_SIMD_X2_MIN = GD_SIMD_X_MIN * GD_SIMD_X_MIN;
+constexpr float GD_SIMD_X2_MAX = FLT_MAX;
+
+// Must match inv_sqrt in gd.cc lane for lane, so the vector kernels use the same instruction.
+inline float gd_simd_inv_sqrt(float x)
+{
+#ifdef STD_INV_SQRT
+  return 1.f / std::sqrt(x);
+#else
+  return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#endif
+}
+
+// Returns true if two of the n weight blocks addressed by indices are the same. Such a group of features must be
+// processed one feature at a time, otherwise the later feature would not see the state written by the earlier one.
+inline bool has_conflict(const uint64_t* indices, size_t n, uint32_t stride_shift)
+{
+  for (size_t i = 1; i < n; ++i)
+  {
+    for (size_t j = 0; j < i; ++j)
+    {
+      if ((indices[i] >> stride_shift) == (indices[j] >> stride_shift)) { return true; }
+    }
+  }
+  return false;
+}
+
+// Scalar equivalent of update_feature with feature_mask off, used for tails and conflicting features.
+inline void update_kernel_impl(float* w, float x, float update, size_t spare)
+{
+  if (x < FLT_MAX && x > -FLT_MAX)
+  {
+    if (spare != 0) { x *= w[spare]; }
+    w[0] += update * x;
+  }
+}
+
+// Scalar equivalent of pred_per_update_feature with sqrt_rate, feature_mask off and stateless off.
+inline bool pred_per_update_kernel_impl(float* w, float x, float grad_squared, size_t adaptive, size_t normalized,
+    size_t spare, float& pred_per_update, float& norm_x)
+{
+  bool overflow = false;
+  float x2 = x * x;
+  if (x2 < GD_SIMD_X2_MIN)
+  {
+    x = (x > 0) ? GD_SIMD_X_MIN : -GD_SIMD_X_MIN;
+    x2 = GD_SIMD_X2_MIN;
+  }
+  if (adaptive != 0) { w[adaptive] += grad_squared * x2; }
+  if (normalized != 0)
+  {
+    float x_abs = std::fabs(x);
+    if (x_abs > w[normalized])
+    {
+      if (w[normalized] > 0.)
+      {
+        float rescale = w[normalized] / x_abs;
+        w[0] *= (adaptive != 0 ? rescale : rescale * rescale);
+      }
+      w[normalized] = x_abs;
+    }
+    float norm_x2 = x2 / (w[normalized] * w[normalized]);
+    if (x2 > GD_SIMD_X2_MAX)
+    {
+      norm_x2 = 1;
+      overflow = true;
+    }
+    norm_x += norm_x2;
+  }
+  float rate_decay = 1.f;
+  if (adaptive != 0) { rate_decay = gd_simd_inv_sqrt(w[adaptive]); }
+  if (normalized != 0)
+  {
+    float inv_norm = 1.f / w[normalized];
+    if (adaptive != 0) { rate_decay *= inv_norm; }
+    else { rate_decay *= inv_norm * inv_norm; }
+  }
+  w[spare] = rate_decay;
+  pred_per_update += x2 * w[spare];
+  return overflow;
+}
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
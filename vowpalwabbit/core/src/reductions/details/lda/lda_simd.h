@@ -0,0 +1,37 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+// Note: SIMD support is currently Linux/x86 only (GCC/Clang).
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+
+#  include <cstddef>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+inline bool cpu_supports_lda_avx2() { return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"); }
+
+inline bool cpu_supports_lda_avx512() { return __builtin_cpu_supports("avx512f"); }
+
+// The kernels below use the same fast approximations of digamma and exp as the SSE code of math-mode 0 in lda_core.cc,
+// 8 or 16 topics at a time.
+
+// Replaces every gamma[k] with max(threshold, exp(digamma(gamma[k]) - digamma(sum of gamma))).
+void lda_expdigammify_avx2(float* gamma, size_t topics, float threshold);
+void lda_expdigammify_avx512(float* gamma, size_t topics, float threshold);
+
+// Replaces every gamma[k] with max(threshold, exp(digamma(gamma[k]) - norm[k])).
+void lda_expdigammify_2_avx2(float* gamma, const float* norm, size_t topics, float threshold);
+void lda_expdigammify_2_avx512(float* gamma, const float* norm, size_t topics, float threshold);
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
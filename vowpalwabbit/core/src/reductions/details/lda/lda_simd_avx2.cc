@@ -0,0 +1,59 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+
+#  include "lda_simd.h"
+#  include "lda_simd_kernel_impl.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+namespace
+{
+class avx2_ops
+{
+public:
+  using vf = __m256;
+  using vi = __m256i;
+  static constexpr size_t WIDTH = 8;
+
+  static vf load(const float* p) { return _mm256_loadu_ps(p); }
+  static void store(float* p, vf x) { _mm256_storeu_ps(p, x); }
+  static vf set1(float x) { return _mm256_set1_ps(x); }
+  static vi set1_int(int x) { return _mm256_set1_epi32(x); }
+  static vf max(vf a, vf b) { return _mm256_max_ps(a, b); }
+  static vf select_less(vf a, vf b, vf if_less, vf otherwise)
+  {
+    return _mm256_blendv_ps(otherwise, if_less, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+  static vi to_int(vf x) { return _mm256_cvttps_epi32(x); }
+  static vf to_float(vi x) { return _mm256_cvtepi32_ps(x); }
+  static vi as_int(vf x) { return _mm256_castps_si256(x); }
+  static vf as_float(vi x) { return _mm256_castsi256_ps(x); }
+  static vi and_int(vi a, vi b) { return _mm256_and_si256(a, b); }
+  static vi or_int(vi a, vi b) { return _mm256_or_si256(a, b); }
+};
+}  // namespace
+
+void lda_expdigammify_avx2(float* gamma, size_t topics, float threshold)
+{
+  lda_kernels<avx2_ops>::expdigammify(gamma, topics, threshold);
+}
+
+void lda_expdigammify_2_avx2(float* gamma, const float* norm, size_t topics, float threshold)
+{
+  lda_kernels<avx2_ops>::expdigammify_2(gamma, norm, topics, threshold);
+}
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
@@ -0,0 +1,59 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+
+#  include "lda_simd.h"
+#  include "lda_simd_kernel_impl.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+namespace
+{
+class avx512_ops
+{
+public:
+  using vf = __m512;
+  using vi = __m512i;
+  static constexpr size_t WIDTH = 16;
+
+  static vf load(const float* p) { return _mm512_loadu_ps(p); }
+  static void store(float* p, vf x) { _mm512_storeu_ps(p, x); }
+  static vf set1(float x) { return _mm512_set1_ps(x); }
+  static vi set1_int(int x) { return _mm512_set1_epi32(x); }
+  static vf max(vf a, vf b) { return _mm512_max_ps(a, b); }
+  static vf select_less(vf a, vf b, vf if_less, vf otherwise)
+  {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), otherwise, if_less);
+  }
+  static vi to_int(vf x) { return _mm512_cvttps_epi32(x); }
+  static vf to_float(vi x) { return _mm512_cvtepi32_ps(x); }
+  static vi as_int(vf x) { return _mm512_castps_si512(x); }
+  static vf as_float(vi x) { return _mm512_castsi512_ps(x); }
+  static vi and_int(vi a, vi b) { return _mm512_and_si512(a, b); }
+  static vi or_int(vi a, vi b) { return _mm512_or_si512(a, b); }
+};
+}  // namespace
+
+void lda_expdigammify_avx512(float* gamma, size_t topics, float threshold)
+{
+  lda_kernels<avx512_ops>::expdigammify(gamma, topics, threshold);
+}
+
+void lda_expdigammify_2_avx512(float* gamma, const float* norm, size_t topics, float threshold)
+{
+  lda_kernels<avx512_ops>::expdigammify_2(gamma, norm, topics, threshold);
+}
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace VW
+{
+namespace reductions
+{
+namespace details
+{
+// The lda kernels are written once against the vector operations of OpsT, which lda_simd_avx2.cc and
+// lda_simd_avx512.cc provide for their register width. Arithmetic uses the GCC/Clang vector extensions.
+template <class OpsT>
+class lda_kernels
+{
+public:
+  using vf = typename OpsT::vf;
+  using vi = typename OpsT::vi;
+  static constexpr size_t WIDTH = OpsT::WIDTH;
+
+  static void expdigammify(float* gamma, size_t topics, float threshold)
+  {
+    float sum = 0.f;
+    for (size_t k = 0; k < topics; k++) { sum += gamma[k]; }
+    const vf digamma_sum = fastdigamma(OpsT::set1(sum));
+    const vf vthreshold = OpsT::set1(threshold);
+    for_each_vector(gamma, nullptr, topics,
+        [digamma_sum, vthreshold](vf g, vf) { return OpsT::max(vthreshold, fastexp(fastdigamma(g) - digamma_sum)); });
+  }
+
+  static void expdigammify_2(float* gamma, const float* norm, size_t topics, float threshold)
+  {
+    const vf vthreshold = OpsT::set1(threshold);
+    for_each_vector(gamma, norm, topics,
+        [vthreshold](vf g, vf n) { return OpsT::max(vthreshold, fastexp(fastdigamma(g) - n)); });
+  }
+
+private:
+  // Replaces gamma with f(gamma, norm) one vector at a time. A zero vector stands in for a null norm.
+  template <class F>
+  static void for_each_vector(float* gamma, const float* norm, size_t topics, F f)
+  {
+    size_t k = 0;
+    for (; k + WIDTH <= topics; k += WIDTH)
+    {
+      OpsT::store(gamma + k, f(OpsT::load(gamma + k), norm == nullptr ? OpsT::set1(0.f) : OpsT::load(norm + k)));
+    }
+    if (k == topics) { return; }
+
+    // The remaining topics go through a padded copy so that no lane reads past the end.
+    float gamma_tail[WIDTH];
+    float norm_tail[WIDTH];
+    std::fill(gamma_tail, gamma_tail + WIDTH, 1.f);
+    std::fill(norm_tail, norm_tail + WIDTH, 0.f);
+    std::copy(gamma + k, gamma + topics, gamma_tail);
+    if (norm != nullptr) { std::copy(norm + k, norm + topics, norm_tail); }
+    OpsT::store(gamma_tail, f(OpsT::load(gamma_tail), OpsT::load(norm_tail)));
+    std::copy(gamma_tail, gamma_tail + (topics - k), gamma + k);
+  }
+
+  static vf fastpow2(vf p)
+  {
+    const vf zero = OpsT::set1(0.f);
+    const vf offset = OpsT::select_less(p, zero, OpsT::set1(1.f), zero);
+    const vf clipp = OpsT::select_less(p, OpsT::set1(-126.f), OpsT::set1(-126.f), p);
+    const vi w = OpsT::to_int(clipp);
+    const vf z = clipp - OpsT::to_float(w) + offset;
+
+    const vf v = OpsT::set1(static_cast<float>(1 << 23)) *
+        (clipp + OpsT::set1(121.2740838f) + OpsT::set1(27.7280233f) / (OpsT::set1(4.84252568f) - z) -
+            OpsT::set1(1.49012907f) * z);
+    return OpsT::as_float(OpsT::to_int(v));
+  }
+
+  static vf fastexp(vf p) { return fastpow2(OpsT::set1(1.442695040f) * p); }
+
+  static vf fastlog2(vf x)
+  {
+    const vi vx_i = OpsT::as_int(x);
+    const vf mx_f =
+        OpsT::as_float(OpsT::or_int(OpsT::and_int(vx_i, OpsT::set1_int(0x007FFFFF)), OpsT::set1_int(0x3f000000)));
+    const vf y = OpsT::to_float(vx_i) * OpsT::set1(1.1920928955078125e-7f);
+
+    return y - OpsT::set1(124.22551499f) - OpsT::set1(1.498030302f) * mx_f -
+        OpsT::set1(1.72587999f) / (OpsT::set1(0.3520887068f) + mx_f);
+  }
+
+  static vf fastlog(vf x) { return OpsT::set1(0.69314718f) * fastlog2(x); }
+
+  static vf fastdigamma(vf x)
+  {
+    const vf twopx = OpsT::set1(2.0f) + x;
+    const vf logterm = fastlog(twopx);
+
+    return (OpsT::set1(-48.0f) + x * (OpsT::set1(-157.0f) + x * (OpsT::set1(-127.0f) - OpsT::set1(30.0f) * x))) /
+        (OpsT::set1(12.0f) * x * (OpsT::set1(1.0f) + x) * twopx * twopx) +
+        logterm;
+  }
+};
+
+}  // namespace details
+}  // namespace reductions
+}  // namespace VW
@@ -24,15 +24,20 @@
 #include "vw/io/logger.h"
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <cfloat>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <ctime>
+#include <future>
 #include <list>
 #include <memory>
 #include <sstream>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace VW::LEARNER;
 using namespace VW::config;
@@ -81,7 +86,7 @@ emt_initial_type emt_initial_type_from_string(VW::string_view val)
   THROW(fmt::format("{} is not valid emt_initial_type", val));
 }
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2)
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2)
 {
   if (initial_type == emt_initial_type::GAUSSIAN) { return 1 - std::exp(-emt_norm(emt_scale_add(1, f1, -1, f2))); }
 
@@ -154,6 +159,19 @@ emt_lru::K emt_lru::bound(emt_lru::K item)
   return nullptr;
 }
 
+namespace
+{
+// An example for scorer_example to populate over and over.
+std::unique_ptr<VW::example> make_scorer_example(emt_tree& b)
+{
+  auto ex = VW::make_unique<VW::example>();
+  ex->interactions = b.empty_interactions_for_ex.get();
+  ex->extent_interactions = b.empty_extent_interactions_for_ex.get();
+  ex->indices.push_back(0);
+  return ex;
+}
+}  // namespace
+
 emt_tree::emt_tree(VW::workspace* all, std::shared_ptr<VW::rand_state> random_state, uint32_t leaf_split,
     emt_scorer_type scorer_type, emt_router_type router_type, emt_initial_type initial_type, uint64_t tree_bound)
     : all(all)
@@ -168,12 +186,9 @@ emt_tree::emt_tree(VW::workspace* all, std::shared_ptr<VW::rand_state> random_st
 
   // we set this up for repeated use later in the scorer.
   // we will populate this examples features over and over.
-  ex = VW::make_unique<VW::example>();
   empty_interactions_for_ex = VW::make_unique<std::vector<std::vector<VW::namespace_index>>>();
   empty_extent_interactions_for_ex = VW::make_unique<std::vector<std::vector<extent_term>>>();
-  ex->interactions = empty_interactions_for_ex.get();
-  ex->extent_interactions = empty_extent_interactions_for_ex.get();
-  ex->indices.push_back(0);
+  ex = make_scorer_example(*this);
 }
 ////////////////////////end of definitions/////////////////
 ///////////////////////////////////////////////////////////
@@ -379,6 +394,29 @@ emt_feats emt_scale_add(float s1, const emt_feats& f1, float s2, const emt_feats
   return out;
 }
 
+uint64_t emt_sketch(const emt_feats& xs)
+{
+  // Signed random projections: bit k is the sign of the projection of xs on a random +-1 direction, whose coordinate
+  // for a feature index is bit k of a hash of the index. The number of bits two sketches differ in grows with the
+  // angle between the two examples.
+  std::array<float, 64> projections{};
+  for (const auto& x : xs)
+  {
+    uint64_t h = x.first * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    for (size_t k = 0; k < projections.size(); k++) { projections[k] += ((h >> k) & 1) != 0 ? x.second : -x.second; }
+  }
+
+  uint64_t sketch = 0;
+  for (size_t k = 0; k < projections.size(); k++)
+  {
+    if (projections[k] > 0) { sketch |= static_cast<uint64_t>(1) << k; }
+  }
+  return sketch;
+}
+
 emt_feats emt_router_random(std::vector<emt_feats>& exs, VW::rand_state& rng)
 {
   std::set<int> is;
@@ -545,10 +583,8 @@ void scorer_features_mul(const emt_feats& f1, const emt_feats& f2, VW::features&
   }
 }
 
-void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
+void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2, VW::example& out)
 {
-  VW::example& out = *b.ex;
-
   static constexpr VW::namespace_index X_NS = 'x';
 
   out.feature_space[X_NS].clear();
@@ -558,8 +594,6 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
     out.indices.clear();
     out.indices.push_back(X_NS);
 
-    out.interactions->clear();
-
     scorer_features_sub(ex1.full, ex2.full, out.feature_space[X_NS]);
 
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq;
@@ -574,8 +608,6 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
     out.indices.clear();
     out.indices.push_back(X_NS);
 
-    out.interactions->clear();
-
     scorer_features_mul(ex1.full, ex2.full, out.feature_space[X_NS]);
 
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq;
@@ -605,27 +637,88 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
   }
 }
 
-float scorer_predict(emt_tree& b, learner& base, const emt_example& pred_ex, const emt_example& leaf_ex)
+// Leaves are only split over the emt threads in ranges of at least this many memories.
+constexpr size_t MIN_MEMORIES_PER_THREAD = 32;
+
+// Scores pred_ex against each of the count memories in leaf_exs. The scorer examples are all built first, possibly over
+// the emt threads, and then go through the base learner as one batch.
+void scorer_predict(
+    emt_tree& b, learner& base, const emt_example& pred_ex, emt_example* const* leaf_exs, size_t count, float* scores)
 {
   if (b.scorer_type == emt_scorer_type::RANDOM)  // random scorer
   {
-    return b.random_state->get_and_update_random();
+    for (size_t i = 0; i < count; i++) { scores[i] = b.random_state->get_and_update_random(); }
+    return;
   }
 
-  if (b.scorer_type == emt_scorer_type::DISTANCE)  // dist scorer
+  while (b.batch_exs.size() < count) { b.batch_exs.push_back(make_scorer_example(b)); }
+
+  auto prepare_range = [&b, &pred_ex, leaf_exs, scores](size_t first, size_t last)
+  {
+    for (size_t i = first; i < last; i++)
+    {
+      const emt_example& leaf_ex = *leaf_exs[i];
+      if (b.scorer_type == emt_scorer_type::DISTANCE)  // dist scorer
+      {
+        scores[i] = emt_initial(b.initial_type, pred_ex.full, leaf_ex.full);
+      }
+      // The features matched exactly. Return max negative to make sure it is picked.
+      // Do I want this here? It doesn't seem to matter on experimental datasets.
+      else if (pred_ex.full == leaf_ex.full) { scores[i] = -FLT_MAX; }
+      else
+      {
+        scorer_example(b, pred_ex, leaf_ex, *b.batch_exs[i]);
+        b.batch_exs[i]->l.simple = {FLT_MAX};
+        scores[i] = FLT_MAX;  // predicted below
+      }
+    }
+  };
+
+  const size_t ranges = b.threads == nullptr ? 1 : std::min(b.threads->size(), count / MIN_MEMORIES_PER_THREAD);
+  if (ranges <= 1) { prepare_range(0, count); }
+  else
   {
-    return emt_initial(b.initial_type, pred_ex.full, leaf_ex.full);
+    std::vector<std::future<void>> futures;
+    futures.reserve(ranges);
+    for (size_t range = 0; range < ranges; range++)
+    {
+      futures.push_back(b.threads->submit(prepare_range, count * range / ranges, count * (range + 1) / ranges));
+    }
+    for (auto& future : futures) { future.get(); }
   }
 
-  // The features matched exactly. Return max negative to make sure it is picked.
-  // Do I want this here? It doesn't seem to matter on experimental datasets.
-  if (pred_ex.full == leaf_ex.full) { return -FLT_MAX; }
+  if (b.scorer_type == emt_scorer_type::DISTANCE) { return; }
 
-  scorer_example(b, pred_ex, leaf_ex);
-  b.ex->l.simple = {FLT_MAX};
-  base.predict(*b.ex);
+  b.batch.clear();
+  for (size_t i = 0; i < count; i++)
+  {
+    if (scores[i] == FLT_MAX) { b.batch.push_back(b.batch_exs[i].get()); }
+  }
+  base.predict_batch(b.batch.data(), b.batch.size());
+  for (size_t i = 0; i < count; i++)
+  {
+    if (scores[i] == FLT_MAX) { scores[i] = b.batch_exs[i]->pred.scalar; }
+  }
+}
 
-  return b.ex->pred.scalar;
+// Keeps the b.prefilter candidates whose sketches are closest to the one of ex, in their current order.
+void prefilter_candidates(const emt_tree& b, const emt_example& ex, std::vector<emt_example*>& candidates)
+{
+  std::vector<std::pair<size_t, size_t>> distances;  // number of differing sketch bits, position in candidates
+  distances.reserve(candidates.size());
+  for (size_t i = 0; i < candidates.size(); i++)
+  {
+    distances.emplace_back(std::bitset<64>(ex.sketch ^ candidates[i]->sketch).count(), i);
+  }
+  std::nth_element(distances.begin(), distances.begin() + (b.prefilter - 1), distances.end());
+  distances.resize(b.prefilter);
+  std::sort(distances.begin(), distances.end(),
+      [](const std::pair<size_t, size_t>& d1, const std::pair<size_t, size_t>& d2) { return d1.second < d2.second; });
+
+  std::vector<emt_example*> kept;
+  kept.reserve(distances.size());
+  for (const auto& d : distances) { kept.push_back(candidates[d.second]); }
+  candidates.swap(kept);
 }
 
 void scorer_learn(learner& base, VW::example& ex, float label, float weight)
@@ -658,8 +751,11 @@ void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& e
   float alternative_error = FLT_MAX;
   emt_example* alternative_ex = nullptr;
 
-  std::vector<float> scores;
-  for (auto& example : cn.examples) { scores.push_back(scorer_predict(b, base, ex, *example)); }
+  std::vector<emt_example*> memories;
+  memories.reserve(cn.examples.size());
+  for (auto& example : cn.examples) { memories.push_back(example.get()); }
+  std::vector<float> scores(memories.size());
+  scorer_predict(b, base, ex, memories.data(), memories.size(), scores.data());
 
   // double loop has time complexity of 2n which is almost always faster than a sort with n*log(n)
   for (size_t i = 0; i < cn.examples.size(); i++)
@@ -698,18 +794,18 @@ void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& e
   {
     if (b.random_state->get_and_update_random() < .5)
     {
-      scorer_example(b, ex, *preferred_ex);
+      scorer_example(b, ex, *preferred_ex, *b.ex);
       scorer_learn(base, *b.ex, int(preferred_error > alternative_error), weight);
 
-      scorer_example(b, ex, *alternative_ex);
+      scorer_example(b, ex, *alternative_ex, *b.ex);
       scorer_learn(base, *b.ex, int(alternative_error > preferred_error), weight);
     }
     else
     {
-      scorer_example(b, ex, *alternative_ex);
+      scorer_example(b, ex, *alternative_ex, *b.ex);
       scorer_learn(base, *b.ex, int(alternative_error > preferred_error), weight);
 
-      scorer_example(b, ex, *preferred_ex);
+      scorer_example(b, ex, *preferred_ex, *b.ex);
       scorer_learn(base, *b.ex, int(preferred_error > alternative_error), weight);
     }
   }
@@ -756,14 +852,20 @@ emt_example* node_pick(emt_tree& b, learner& base, emt_node& cn, const emt_examp
   // shuffle the examples to break ties randomly
   emt_shuffle(cn.examples.begin(), cn.examples.end(), *b.random_state);
 
-  for (auto const& example : cn.examples)
-  {
-    float score = scorer_predict(b, base, ex, *example);
+  std::vector<emt_example*> candidates;
+  candidates.reserve(cn.examples.size());
+  for (auto const& example : cn.examples) { candidates.push_back(example.get()); }
+  if (b.prefilter > 0 && candidates.size() > b.prefilter) { prefilter_candidates(b, ex, candidates); }
 
-    if (score < best_score)
+  std::vector<float> scores(candidates.size());
+  scorer_predict(b, base, ex, candidates.data(), candidates.size(), scores.data());
+
+  for (size_t i = 0; i < candidates.size(); i++)
+  {
+    if (scores[i] < best_score)
     {
-      best_score = score;
-      best_example = example.get();
+      best_score = scores[i];
+      best_example = candidates[i];
     }
   }
 
@@ -782,6 +884,7 @@ void emt_predict(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
   emt_example ex(*b.all, &ec);
+  if (b.prefilter > 0) { ex.sketch = emt_sketch(ex.full); }
   emt_node& cn = *tree_route(b, ex);
   node_predict(b, base, cn, ex, ec);
 }
@@ -790,6 +893,7 @@ void emt_learn(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
   auto ex = VW::make_unique<emt_example>(*b.all, &ec);
+  if (b.prefilter > 0) { ex->sketch = emt_sketch(ex->full); }
 
   emt_node& cn = *tree_route(b, *ex);
   node_predict(b, base, cn, *ex, ec);  // vw learners predict and emt_learn
@@ -900,10 +1004,22 @@ size_t write_model_field(
 
 namespace
 {
+void emt_sketch_memories(VW::reductions::eigen_memory_tree::emt_node& node)
+{
+  for (auto& ex : node.examples) { ex->sketch = VW::reductions::eigen_memory_tree::emt_sketch(ex->full); }
+  if (node.left != nullptr) { emt_sketch_memories(*node.left); }
+  if (node.right != nullptr) { emt_sketch_memories(*node.right); }
+}
+
 void emt_save_load_tree(VW::reductions::eigen_memory_tree::emt_tree& tree, VW::io_buf& io, bool read, bool text)
 {
   if (io.num_files() == 0) { return; }
-  if (read) { VW::model_utils::read_model_field(io, tree); }
+  if (read)
+  {
+    VW::model_utils::read_model_field(io, tree);
+    // sketches are not saved with the model
+    if (tree.prefilter > 0) { emt_sketch_memories(*tree.root); }
+  }
   else { VW::model_utils::write_model_field(io, tree, "emt", text); }
 }
 }  // namespace
@@ -921,6 +1037,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   std::string initial_type;
   uint32_t tree_bound = 0;
   uint32_t leaf_split = 0;
+  uint32_t prefilter = 0;
+  uint64_t threads = 1;
 
   option_group_definition new_options("[Reduction] Eigen Memory Tree");
   new_options.add(make_option("emt", enabled).keep().necessary().help("Make an eigen memory tree"))
@@ -946,7 +1064,16 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
                .keep()
                .one_of({"random", "eigen"})
                .default_value("eigen")
-               .help("Indicates the type of router to use"));
+               .help("Indicates the type of router to use"))
+      .add(make_option("emt_prefilter", prefilter)
+               .default_value(0)
+               .experimental()
+               .help("Indicates how many memories of a leaf the scorer compares when predicting, picked by the random "
+                     "projection sketches closest to the example. 0 compares all of them"))
+      .add(make_option("emt_threads", threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads building the scorer examples of a leaf"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -961,6 +1088,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   auto t = VW::make_unique<VW::reductions::eigen_memory_tree::emt_tree>(&all, all.get_random_state(), leaf_split,
       emt_scorer_type_from_string(scorer_type), emt_router_type_from_string(router_type),
       emt_initial_type_from_string(initial_type), tree_bound);
+  t->prefilter = prefilter;
+  if (threads == 0) { THROW("emt_threads should be positive") }
+  if (threads > 1) { t->threads = VW::make_unique<VW::thread_pool>(VW::cast_to_smaller_type<size_t>(threads)); }
 
   auto l =
       make_reduction_learner(std::move(t), require_singleline(stack_builder.setup_base_learner()), emt_learn,
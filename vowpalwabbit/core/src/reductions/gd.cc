@@ -4,6 +4,7 @@
 
 #include "vw/core/reductions/gd.h"
 
+#include "details/gd/gd_simd.h"
 #include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
 #include "vw/core/crossplat_compat.h"
@@ -215,11 +216,47 @@ float average_update(float total_weight, float normalized_sum_norm_x, float neg_
   return 1.f;
 }
 
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+// Same traversal as foreach_feature for dense weights, but each linear namespace is handed to linear_kernel as a
+// whole. Interactions still go through FuncT one feature at a time.
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class LinearKernelT>
+void foreach_feature_simd(VW::workspace& all, VW::example& ec, DataT& dat, size_t& num_interacted_features,
+    LinearKernelT&& linear_kernel)
+{
+  const bool ignore_some_linear = all.feature_tweaks_config.ignore_some_linear;
+  const auto& ignore_linear = all.feature_tweaks_config.ignore_linear;
+  for (auto i = ec.begin(); i != ec.end(); ++i)
+  {
+    if (ignore_some_linear && ignore_linear[i.index()]) { continue; }
+    linear_kernel(*i);
+  }
+  VW::generate_interactions<DataT, WeightOrIndexT, FuncT, VW::dense_parameters>(*ec.interactions,
+      *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, dat, all.weights.dense_weights,
+      num_interacted_features, all.runtime_state.generate_interactions_object_cache_state);
+}
+#endif
+
 template <bool sqrt_rate, bool feature_mask_off, size_t adaptive, size_t normalized, size_t spare>
 void train(VW::reductions::gd& g, VW::example& ec, float update)
 {
   if VW_STD17_CONSTEXPR (normalized != 0) { update *= g.update_multiplier; }
   VW_DBG(ec) << "gd: train() spare=" << spare << std::endl;
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+  if (feature_mask_off && g.simd != VW::reductions::details::gd_simd_type::NO_SIMD)
+  {
+    auto& weights = g.all->weights.dense_weights;
+    const bool avx512 = g.simd == VW::reductions::details::gd_simd_type::AVX512;
+    size_t num_interacted_features = 0;
+    foreach_feature_simd<float, float&, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>>(
+        *g.all, ec, update, num_interacted_features,
+        [&](const VW::features& fs)
+        {
+          if (avx512) { VW::reductions::details::linear_update_avx512(weights, fs, ec.ft_offset, update, spare); }
+          else { VW::reductions::details::linear_update_avx2(weights, fs, ec.ft_offset, update, spare); }
+        });
+    return;
+  }
+#endif
   VW::foreach_feature<float, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>>(
       *g.all, ec, update);
 }
@@ -228,9 +265,12 @@ void end_pass(VW::reductions::gd& g)
 {
   VW::workspace& all = *g.all;
 
+  // The average of the previous pass has to land before this pass is synchronized or anything else is reduced.
+  g.async_average.finish(all.weights);
+
   if (!all.output_model_config.save_resume) { sync_weights(all); }
 
-  if (all.runtime_state.all_reduce != nullptr)
+  if (all.runtime_state.all_reduce != nullptr && !g.async_all_reduce)
   {
     if (all.weights.adaptive) { VW::details::accumulate_weighted_avg(all, all.weights); }
     else { VW::details::accumulate_avg(all, all.weights, 0); }
@@ -254,8 +294,12 @@ void end_pass(VW::reductions::gd& g)
       VW::details::set_done(all);
     }
   }
+
+  if (all.runtime_state.all_reduce != nullptr && g.async_all_reduce) { g.async_average.start(all, all.weights); }
 }
 
+void end_examples(VW::reductions::gd& g) { g.async_average.finish(g.all->weights); }
+
 void merge(const std::vector<float>& per_model_weighting, const std::vector<const VW::workspace*>& all_workspaces,
     const std::vector<const VW::reductions::gd*>& all_data, VW::workspace& output_workspace,
     VW::reductions::gd& output_data)
@@ -528,6 +572,105 @@ inline float trunc_predict(VW::workspace& all, VW::example& ec, double gravity,
   return temp.prediction;
 }
 
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+inline float simd_predict(VW::reductions::gd& g, VW::example& ec, size_t& num_interacted_features)
+{
+  VW::workspace& all = *g.all;
+  const auto& weights = all.weights.dense_weights;
+  const bool avx512 = g.simd == VW::reductions::details::gd_simd_type::AVX512;
+  float prediction = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().initial;
+  foreach_feature_simd<float, float, VW::details::vec_add>(all, ec, prediction, num_interacted_features,
+      [&](const VW::features& fs)
+      {
+        prediction += avx512 ? VW::reductions::details::linear_predict_avx512(weights, fs, ec.ft_offset)
+                             : VW::reductions::details::linear_predict_avx2(weights, fs, ec.ft_offset);
+      });
+  return prediction;
+}
+#endif
+
+template <class WeightsT>
+float shared_linear_score(VW::workspace& all, const WeightsT& weights, const VW::example& shared, uint64_t offset)
+{
+  const bool ignore_some_linear = all.feature_tweaks_config.ignore_some_linear;
+  const auto& ignore_linear = all.feature_tweaks_config.ignore_linear;
+  float score = 0.f;
+  for (VW::namespace_index idx : shared.indices)
+  {
+    // The constant feature of the shared example is not appended to the actions.
+    if (idx == VW::details::CONSTANT_NAMESPACE || (ignore_some_linear && ignore_linear[idx])) { continue; }
+    for (const auto& f : shared.feature_space[idx]) { score += weights.get(f.index() + offset) * f.value(); }
+  }
+  return score;
+}
+
+template <class WeightsT>
+float cached_shared_score(VW::reductions::gd& g, const WeightsT& weights,
+    const VW::shared_feature_merger::reduction_features& shared, uint64_t offset)
+{
+  auto& cache = g.shared_scores;
+  if (cache.multi_ex_id != shared.multi_ex_id || cache.weights_version != g.weights_version)
+  {
+    cache.multi_ex_id = shared.multi_ex_id;
+    cache.weights_version = g.weights_version;
+    cache.scores.clear();
+  }
+  for (const auto& entry : cache.scores)
+  {
+    if (entry.first == offset) { return entry.second; }
+  }
+  const float score = shared_linear_score(*g.all, weights, *shared.shared_example, offset);
+  cache.scores.emplace_back(offset, score);
+  return score;
+}
+
+// Same as inline_predict, but the linear terms of the features appended from the shared example are looked up in
+// g.shared_scores instead of being summed for every action.
+template <class WeightsT>
+float shared_cached_predict(VW::reductions::gd& g, WeightsT& weights, VW::example& ec,
+    const VW::shared_feature_merger::reduction_features& shared, size_t& num_interacted_features)
+{
+  VW::workspace& all = *g.all;
+  const bool ignore_some_linear = all.feature_tweaks_config.ignore_some_linear;
+  const auto& ignore_linear = all.feature_tweaks_config.ignore_linear;
+  const uint64_t offset = ec.ft_offset;
+  float prediction = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().initial +
+      cached_shared_score(g, static_cast<const WeightsT&>(weights), shared, offset);
+  for (auto i = ec.begin(); i != ec.end(); ++i)
+  {
+    if (ignore_some_linear && ignore_linear[i.index()]) { continue; }
+    const VW::features& fs = *i;
+    size_t begin = fs.size();
+    size_t end = fs.size();
+    for (const auto& range : shared.appended)
+    {
+      if (range.index == i.index())
+      {
+        begin = range.begin;
+        end = range.end;
+        break;
+      }
+    }
+    for (size_t k = 0; k < begin; ++k) { prediction += weights.get(fs.indices[k] + offset) * fs.values[k]; }
+    for (size_t k = end; k < fs.size(); ++k) { prediction += weights.get(fs.indices[k] + offset) * fs.values[k]; }
+  }
+  VW::generate_interactions<float, float, VW::details::vec_add, WeightsT>(*ec.interactions, *ec.extent_interactions,
+      all.feature_tweaks_config.permutations, ec, prediction, weights, num_interacted_features,
+      all.runtime_state.generate_interactions_object_cache_state);
+  return prediction;
+}
+
+// Whether the features recorded by shared_feature_merger are still where it appended them.
+inline bool can_cache_shared_score(const VW::example& ec, const VW::shared_feature_merger::reduction_features& shared)
+{
+  if (shared.multi_ex_id == 0) { return false; }
+  for (const auto& range : shared.appended)
+  {
+    if (ec.feature_space[range.index].size() < range.end) { return false; }
+  }
+  return true;
+}
+
 template <bool l1, bool audit>
 void predict(VW::reductions::gd& g, VW::example& ec)
 {
@@ -535,7 +678,20 @@ void predict(VW::reductions::gd& g, VW::example& ec)
 
   VW::workspace& all = *g.all;
   size_t num_interacted_features = 0;
+  const auto& shared = ec.ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>();
   if (l1) { ec.partial_prediction = trunc_predict(all, ec, all.sd->gravity, num_interacted_features); }
+  else if (!audit && can_cache_shared_score(ec, shared))
+  {
+    ec.partial_prediction = all.weights.sparse
+        ? shared_cached_predict(g, all.weights.sparse_weights, ec, shared, num_interacted_features)
+        : shared_cached_predict(g, all.weights.dense_weights, ec, shared, num_interacted_features);
+  }
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+  else if (g.simd != VW::reductions::details::gd_simd_type::NO_SIMD)
+  {
+    ec.partial_prediction = simd_predict(g, ec, num_interacted_features);
+  }
+#endif
   else { ec.partial_prediction = inline_predict(all, ec, num_interacted_features); }
 
   ec.num_features_from_interactions = num_interacted_features;
@@ -548,6 +704,33 @@ void predict(VW::reductions::gd& g, VW::example& ec)
   if (audit) { VW::details::print_audit_features(all, ec); }
 }
 
+#if defined(__GNUC__) || defined(__clang__)
+// Requests the weight lines of the linear features of ec, so they are on their way into cache while the example before
+// it is scored. Interacted features are not prefetched, their indices are only known while they are generated.
+inline void prefetch_weights(const VW::dense_parameters& weights, const VW::example& ec)
+{
+  for (auto ns : ec.indices)
+  {
+    for (auto index : ec.feature_space[ns].indices) { __builtin_prefetch(&weights[index + ec.ft_offset]); }
+  }
+}
+#else
+inline void prefetch_weights(const VW::dense_parameters&, const VW::example&) {}
+#endif
+
+template <bool l1, bool audit>
+void predict_batch(VW::reductions::gd& g, VW::example* const* examples, size_t count)
+{
+  const auto& weights = g.all->weights;
+  const bool prefetch = !weights.sparse;
+  if (prefetch && count > 0) { prefetch_weights(weights.dense_weights, *examples[0]); }
+  for (size_t k = 0; k < count; k++)
+  {
+    if (prefetch && k + 1 < count) { prefetch_weights(weights.dense_weights, *examples[k + 1]); }
+    predict<l1, audit>(g, *examples[k]);
+  }
+}
+
 template <class T>
 inline void vec_add_trunc_multipredict(VW::details::multipredict_info<T>& mp, const float fx, uint64_t fi)
 {
@@ -740,8 +923,33 @@ float get_pred_per_update(VW::reductions::gd& g, VW::example& ec)
   if (grad_squared == 0 && !stateless) { return 1.; }
 
   norm_data nd = {grad_squared, 0., 0., {g.neg_power_t, g.neg_norm_power}, {0}, &g.all->logger};
-  VW::foreach_feature<norm_data,
-      pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd);
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+  // The kernels implement the sqrt_rate update of live weights only, everything else stays on the scalar path.
+  if (sqrt_rate && feature_mask_off && !stateless && (adaptive != 0 || normalized != 0) &&
+      g.simd != VW::reductions::details::gd_simd_type::NO_SIMD)
+  {
+    auto& weights = all.weights.dense_weights;
+    const bool avx512 = g.simd == VW::reductions::details::gd_simd_type::AVX512;
+    size_t num_interacted_features = 0;
+    foreach_feature_simd<norm_data, float&,
+        pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd,
+        num_interacted_features,
+        [&](const VW::features& fs)
+        {
+          const bool overflow = avx512
+              ? VW::reductions::details::linear_pred_per_update_avx512(weights, fs, ec.ft_offset, nd.grad_squared,
+                    adaptive, normalized, spare, nd.pred_per_update, nd.norm_x)
+              : VW::reductions::details::linear_pred_per_update_avx2(weights, fs, ec.ft_offset, nd.grad_squared,
+                    adaptive, normalized, spare, nd.pred_per_update, nd.norm_x);
+          if (overflow) { nd.logger->err_error("The features have too much magnitude"); }
+        });
+  }
+  else
+#endif
+  {
+    VW::foreach_feature<norm_data,
+        pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd);
+  }
   if VW_STD17_CONSTEXPR (normalized != 0)
   {
     if (!stateless)
@@ -804,38 +1012,34 @@ float sensitivity(VW::reductions::gd& g, VW::example& ec)
   g.current_model_state = nullptr;
 }
 
-template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
-    size_t normalized, size_t spare>
-float compute_update(VW::reductions::gd& g, VW::example& ec)
+// The update of an example with a positive loss, given the pred_per_update of its features.
+template <bool invariant, size_t adaptive>
+float scaled_update(VW::reductions::gd& g, VW::example& ec, float pred_per_update)
 {
-  // invariant: not a test label, importance weight > 0
   const auto& ld = ec.l.simple;
   VW::workspace& all = *g.all;
 
-  float update = 0.;
-  ec.updated_prediction = ec.pred.scalar;
-  if (all.loss_config.loss->get_loss(all.sd.get(), ec.pred.scalar, ld.label) > 0.)
-  {
-    float pred_per_update = sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, false>(g, ec);
-    float update_scale = get_scale<adaptive>(g, ec, ec.weight);
-    if (invariant)
-    {
-      update = all.loss_config.loss->get_update(ec.pred.scalar, ld.label, update_scale, pred_per_update);
-    }
-    else { update = all.loss_config.loss->get_unsafe_update(ec.pred.scalar, ld.label, update_scale); }
-    // changed from ec.partial_prediction to ld.prediction
-    ec.updated_prediction += pred_per_update * update;
+  float update;
+  float update_scale = get_scale<adaptive>(g, ec, ec.weight);
+  if (invariant) { update = all.loss_config.loss->get_update(ec.pred.scalar, ld.label, update_scale, pred_per_update); }
+  else { update = all.loss_config.loss->get_unsafe_update(ec.pred.scalar, ld.label, update_scale); }
+  // changed from ec.partial_prediction to ld.prediction
+  ec.updated_prediction += pred_per_update * update;
 
-    if (all.loss_config.reg_mode && std::fabs(update) > 1e-8)
-    {
-      double dev1 = all.loss_config.loss->first_derivative(all.sd.get(), ec.pred.scalar, ld.label);
-      double eta_bar = (fabs(dev1) > 1e-8) ? (-update / dev1) : 0.0;
-      if (fabs(dev1) > 1e-8) { all.sd->contraction *= (1. - all.loss_config.l2_lambda * eta_bar); }
-      update /= static_cast<float>(all.sd->contraction);
-      all.sd->gravity += eta_bar * all.loss_config.l1_lambda;
-    }
+  if (all.loss_config.reg_mode && std::fabs(update) > 1e-8)
+  {
+    double dev1 = all.loss_config.loss->first_derivative(all.sd.get(), ec.pred.scalar, ld.label);
+    double eta_bar = (fabs(dev1) > 1e-8) ? (-update / dev1) : 0.0;
+    if (fabs(dev1) > 1e-8) { all.sd->contraction *= (1. - all.loss_config.l2_lambda * eta_bar); }
+    update /= static_cast<float>(all.sd->contraction);
+    all.sd->gravity += eta_bar * all.loss_config.l1_lambda;
   }
+  return update;
+}
 
+template <bool sparse_l2>
+float finish_update(VW::reductions::gd& g, VW::example& ec, float update)
+{
   if (sparse_l2) { update -= g.sparse_l2 * ec.pred.scalar; }
 
   if (std::isnan(update))
@@ -847,10 +1051,30 @@ float compute_update(VW::reductions::gd& g, VW::example& ec)
   return update;
 }
 
+template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
+    size_t normalized, size_t spare>
+float compute_update(VW::reductions::gd& g, VW::example& ec)
+{
+  // invariant: not a test label, importance weight > 0
+  const auto& ld = ec.l.simple;
+  VW::workspace& all = *g.all;
+
+  float update = 0.;
+  ec.updated_prediction = ec.pred.scalar;
+  if (all.loss_config.loss->get_loss(all.sd.get(), ec.pred.scalar, ld.label) > 0.)
+  {
+    float pred_per_update = sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, false>(g, ec);
+    update = scaled_update<invariant, adaptive>(g, ec, pred_per_update);
+  }
+
+  return finish_update<sparse_l2>(g, ec, update);
+}
+
 template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
     size_t normalized, size_t spare>
 void update(VW::reductions::gd& g, VW::example& ec)
 {
+  g.weights_version++;
   if (g.current_model_state == nullptr)
   {
     g.current_model_state = &(g.gd_per_model_states[ec.ft_offset / g.all->weights.stride()]);
@@ -870,6 +1094,165 @@ void update(VW::reductions::gd& g, VW::example& ec)
   g.current_model_state = nullptr;
 }
 
+// State of one output of multiupdate between the pass computing pred_per_update and the one applying the update.
+class multiupdate_output
+{
+public:
+  norm_data nd;
+  float update;
+  bool has_loss;
+};
+
+template <class WeightsT>
+class multiupdate_info
+{
+public:
+  size_t count;
+  size_t step;
+  WeightsT& weights;
+  multiupdate_output* outputs;
+};
+
+template <bool sqrt_rate, bool feature_mask_off, size_t adaptive, size_t normalized, size_t spare, class WeightsT>
+inline void multi_pred_per_update_feature(multiupdate_info<WeightsT>& mu, const float x, uint64_t fi)
+{
+  for (size_t c = 0; c < mu.count; c++, fi += mu.step)
+  {
+    auto& out = mu.outputs[c];
+    if (out.has_loss && out.nd.grad_squared != 0)
+    {
+      pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, false>(
+          out.nd, x, mu.weights[fi]);
+    }
+  }
+}
+
+template <bool sqrt_rate, bool feature_mask_off, size_t adaptive, size_t normalized, size_t spare, class WeightsT>
+inline void multi_update_feature(multiupdate_info<WeightsT>& mu, const float x, uint64_t fi)
+{
+  for (size_t c = 0; c < mu.count; c++, fi += mu.step)
+  {
+    auto& out = mu.outputs[c];
+    if (out.update != 0.f)
+    {
+      update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>(out.update, x, mu.weights[fi]);
+    }
+  }
+}
+
+// Same result as calling update for each output in turn, as long as the outputs don't share weights, but the features
+// and interactions are only generated twice: once to sum pred_per_update and once to apply all the updates.
+template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
+    size_t normalized, size_t spare, class WeightsT>
+void fused_multiupdate(VW::reductions::gd& g, WeightsT& weights, VW::example& ec, size_t count, size_t step,
+    const float* labels, const VW::polyprediction* pred)
+{
+  VW::workspace& all = *g.all;
+  static thread_local std::vector<multiupdate_output> outputs;
+  outputs.resize(count);
+  multiupdate_info<WeightsT> mu = {count, step, weights, outputs.data()};
+
+  bool needs_norms = false;
+  for (size_t c = 0; c < count; c++)
+  {
+    auto& out = outputs[c];
+    out.has_loss = all.loss_config.loss->get_loss(all.sd.get(), pred[c].scalar, labels[c]) > 0.;
+    float grad_squared = ec.weight;
+    if (out.has_loss && !adax) { grad_squared *= all.loss_config.loss->get_square_grad(pred[c].scalar, labels[c]); }
+    out.nd = {grad_squared, 0., 0., {g.neg_power_t, g.neg_norm_power}, {0}, &all.logger};
+    needs_norms = needs_norms || (out.has_loss && grad_squared != 0);
+  }
+
+  size_t num_interacted_features = 0;
+  if VW_STD17_CONSTEXPR (adaptive != 0 || normalized != 0)
+  {
+    if (needs_norms)
+    {
+      VW::foreach_feature<multiupdate_info<WeightsT>, uint64_t,
+          multi_pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, WeightsT>>(
+          all, ec, mu, num_interacted_features);
+    }
+  }
+
+  // The per output part of compute_update, in the same order as sequential updates would run it.
+  bool any_update = false;
+  for (size_t c = 0; c < count; c++)
+  {
+    auto& out = outputs[c];
+    ec.l.simple.label = labels[c];
+    ec.pred.scalar = pred[c].scalar;
+    ec.updated_prediction = ec.pred.scalar;
+    float update = 0.;
+    if (out.has_loss)
+    {
+      float pred_per_update = 1.f;
+      if VW_STD17_CONSTEXPR (adaptive != 0 || normalized != 0)
+      {
+        if (out.nd.grad_squared != 0)
+        {
+          pred_per_update = out.nd.pred_per_update;
+          if VW_STD17_CONSTEXPR (normalized != 0)
+          {
+            auto& state = g.gd_per_model_states[(ec.ft_offset + c * step) / all.weights.stride()];
+            state.normalized_sum_norm_x += (static_cast<double>(ec.weight)) * out.nd.norm_x;
+            state.total_weight += ec.weight;
+            g.update_multiplier = average_update<sqrt_rate, adaptive, normalized>(
+                static_cast<float>(state.total_weight), static_cast<float>(state.normalized_sum_norm_x),
+                g.neg_norm_power);
+            pred_per_update *= g.update_multiplier;
+          }
+        }
+      }
+      else { pred_per_update = ec.get_total_sum_feat_sq(); }
+      update = scaled_update<invariant, adaptive>(g, ec, pred_per_update);
+    }
+    update = finish_update<sparse_l2>(g, ec, update);
+    if VW_STD17_CONSTEXPR (normalized != 0) { update *= g.update_multiplier; }
+    out.update = update;
+    any_update = any_update || update != 0.f;
+  }
+  g.weights_version += count;
+
+  if (any_update)
+  {
+    VW::foreach_feature<multiupdate_info<WeightsT>, uint64_t,
+        multi_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, WeightsT>>(
+        all, ec, mu, num_interacted_features);
+  }
+}
+
+template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
+    size_t normalized, size_t spare>
+void multiupdate(VW::reductions::gd& g, VW::example& ec, size_t count, size_t step, const float* labels,
+    const VW::polyprediction* pred)
+{
+  // Regularization couples the outputs through the contraction and gravity of the shared data, and the explicit SIMD
+  // kernels round differently from the fused pass, so both keep updating one output at a time.
+  if (g.all->loss_config.reg_mode || g.simd != VW::reductions::details::gd_simd_type::NO_SIMD)
+  {
+    for (size_t c = 0; c < count; c++)
+    {
+      ec.l.simple.label = labels[c];
+      ec.pred.scalar = pred[c].scalar;
+      update<sparse_l2, invariant, sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare>(g, ec);
+      ec.ft_offset += static_cast<uint64_t>(step);
+    }
+    ec.ft_offset -= static_cast<uint64_t>(step * count);
+    return;
+  }
+
+  if (g.all->weights.sparse)
+  {
+    fused_multiupdate<sparse_l2, invariant, sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare>(
+        g, g.all->weights.sparse_weights, ec, count, step, labels, pred);
+  }
+  else
+  {
+    fused_multiupdate<sparse_l2, invariant, sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare>(
+        g, g.all->weights.dense_weights, ec, count, step, labels, pred);
+  }
+}
+
 template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
     size_t normalized, size_t spare>
 void learn(VW::reductions::gd& g, VW::example& ec)
@@ -920,6 +1303,123 @@ std::string to_string(const VW::details::invert_hash_info& info)
   return ss.str();
 }
 
+// Dense model layout: an index one past the last weight, which older readers reject as corrupt, followed by the number
+// of floats in the block, padding up to the next page boundary of the output and the raw weight array including the
+// extra state of the update rule. Page alignment lets the block be memory mapped straight into dense_parameters.
+constexpr size_t DENSE_BLOCK_ALIGNMENT = 4096;
+constexpr size_t DENSE_BLOCK_CHUNK_SIZE = 1 << 20;
+
+bool save_dense_block(VW::workspace& all, VW::io_buf& model_file, VW::dense_parameters& weights)
+{
+  std::stringstream msg;
+  const uint64_t length = static_cast<uint64_t>(1) << all.initial_weights_config.num_bits;
+  write_index(model_file, msg, false, all.initial_weights_config.num_bits, length);
+
+  const uint64_t raw_length = weights.raw_length();
+  model_file.bin_write_fixed(reinterpret_cast<const char*>(&raw_length), sizeof(raw_length));
+  const size_t block_start = model_file.bytes_written() + sizeof(uint32_t);
+  const auto padding =
+      static_cast<uint32_t>((DENSE_BLOCK_ALIGNMENT - block_start % DENSE_BLOCK_ALIGNMENT) % DENSE_BLOCK_ALIGNMENT);
+  model_file.bin_write_fixed(reinterpret_cast<const char*>(&padding), sizeof(padding));
+  const std::vector<char> zeros(padding, 0);
+  model_file.bin_write_fixed(zeros.data(), zeros.size());
+
+  // Written in chunks so that the io_buf does not grow to the size of the model.
+  const auto* data = reinterpret_cast<const char*>(weights.data());
+  const size_t num_bytes = raw_length * sizeof(VW::weight);
+  for (size_t offset = 0; offset < num_bytes; offset += DENSE_BLOCK_CHUNK_SIZE)
+  {
+    model_file.bin_write_fixed(data + offset, std::min(DENSE_BLOCK_CHUNK_SIZE, num_bytes - offset));
+  }
+  return true;
+}
+
+bool save_dense_block(VW::workspace&, VW::io_buf&, VW::sparse_parameters&) { return false; }
+
+void load_dense_block(VW::workspace& all, VW::io_buf& model_file, VW::dense_parameters& weights)
+{
+  uint64_t raw_length = 0;
+  uint32_t padding = 0;
+  if (model_file.bin_read_fixed(reinterpret_cast<char*>(&raw_length), sizeof(raw_length)) != sizeof(raw_length) ||
+      model_file.bin_read_fixed(reinterpret_cast<char*>(&padding), sizeof(padding)) != sizeof(padding) ||
+      padding >= DENSE_BLOCK_ALIGNMENT)
+  {
+    THROW("Model content is corrupted, dense weight block header is truncated");
+  }
+  const uint64_t length = static_cast<uint64_t>(1) << all.initial_weights_config.num_bits;
+  const uint64_t block_stride = raw_length / length;
+  if (block_stride == 0 || raw_length % length != 0 || (block_stride & (block_stride - 1)) != 0)
+  {
+    THROW("Model content is corrupted, dense weight block of " << raw_length << " floats does not match "
+                                                               << length << " weights");
+  }
+  std::vector<char> skipped(padding);
+  if (model_file.bin_read_fixed(skipped.data(), skipped.size()) != skipped.size())
+  {
+    THROW("Model content is corrupted, dense weight block header is truncated");
+  }
+
+  const size_t num_bytes = raw_length * sizeof(VW::weight);
+  if (raw_length != weights.raw_length())
+  {
+    // The model was saved with a different update rule, which happens for predict only models. Only the components
+    // both layouts have in common are copied.
+    const uint64_t common_stride = std::min(block_stride, weights.stride());
+    std::vector<VW::weight> chunk(std::max<uint64_t>(DENSE_BLOCK_CHUNK_SIZE / sizeof(VW::weight), block_stride));
+    for (uint64_t index = 0; index < length;)
+    {
+      const uint64_t chunk_weights = std::min<uint64_t>(chunk.size() / block_stride, length - index);
+      const size_t chunk_bytes = chunk_weights * block_stride * sizeof(VW::weight);
+      if (model_file.bin_read_fixed(reinterpret_cast<char*>(chunk.data()), chunk_bytes) != chunk_bytes)
+      {
+        THROW("Model content is corrupted, dense weight block is truncated");
+      }
+      for (uint64_t j = 0; j < chunk_weights; ++j, ++index)
+      {
+        VW::weight* v = &weights.strided_index(index);
+        for (uint64_t k = 0; k < common_stride; ++k) { v[k] = chunk[j * block_stride + k]; }
+      }
+    }
+    return;
+  }
+
+  if (all.initial_weights_config.mmap_model)
+  {
+    const auto& initial_regressors = all.initial_weights_config.initial_regressors;
+    if (std::find(initial_regressors.begin(), initial_regressors.end(),
+            all.output_model_config.final_regressor_name) != initial_regressors.end())
+    {
+      all.logger.err_warn("--mmap_model is ignored because the final regressor overwrites the initial regressor");
+    }
+    else
+    {
+      auto mapped = model_file.map_copy_on_write(num_bytes);
+      if (mapped != nullptr && reinterpret_cast<uintptr_t>(mapped.get()) % alignof(VW::weight) == 0)
+      {
+        weights.set_memory(std::shared_ptr<VW::weight>(mapped, reinterpret_cast<VW::weight*>(mapped.get())));
+        return;
+      }
+      if (mapped != nullptr) { THROW("Model content is corrupted, dense weight block is not aligned"); }
+      all.logger.err_warn("--mmap_model is ignored because the model input cannot be memory mapped");
+    }
+  }
+
+  auto* data = reinterpret_cast<char*>(weights.data());
+  for (size_t offset = 0; offset < num_bytes; offset += DENSE_BLOCK_CHUNK_SIZE)
+  {
+    const size_t chunk = std::min(DENSE_BLOCK_CHUNK_SIZE, num_bytes - offset);
+    if (model_file.bin_read_fixed(data + offset, chunk) != chunk)
+    {
+      THROW("Model content is corrupted, dense weight block is truncated");
+    }
+  }
+}
+
+void load_dense_block(VW::workspace&, VW::io_buf&, VW::sparse_parameters&)
+{
+  THROW("Models saved with --dense_model_layout cannot be loaded with --sparse_weights");
+}
+
 template <class T>
 void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read, bool text, T& weights)
 {
@@ -963,6 +1463,11 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
         i = old_i;
       }
       else { brw = model_file.bin_read_fixed(reinterpret_cast<char*>(&i), sizeof(i)); }
+      if (brw > 0 && i == length)
+      {
+        load_dense_block(all, model_file, weights);
+        break;
+      }
       if (brw > 0)
       {
         if (i >= length)
@@ -975,6 +1480,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
   }
   else  // write
   {
+    if (all.output_model_config.dense_model_layout && !text && save_dense_block(all, model_file, weights)) { return; }
     for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
     {
       if (*v != 0.)
@@ -1018,6 +1524,11 @@ void save_load_online_state_weights(VW::workspace& all, VW::io_buf& model_file,
         i = old_i;
       }
       else { brw = model_file.bin_read_fixed(reinterpret_cast<char*>(&i), sizeof(i)); }
+      if (brw > 0 && i == length)
+      {
+        load_dense_block(all, model_file, weights);
+        break;
+      }
       if (brw > 0)
       {
         if (i >= length)
@@ -1048,6 +1559,11 @@ void save_load_online_state_weights(VW::workspace& all, VW::io_buf& model_file,
   }
   else
   {  // write binary or text
+    if (all.output_model_config.dense_model_layout && !text && !all.output_config.print_invert &&
+        save_dense_block(all, model_file, weights))
+    {
+      return;
+    }
     if (all.output_config.hexfloat_weights && (text || all.output_config.print_invert)) { msg << std::hexfloat; }
 
     for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
@@ -1368,6 +1884,7 @@ uint64_t set_learn(VW::workspace& all, VW::reductions::gd& g)
   {
     g.learn = learn<sparse_l2, invariant, sqrt_rate, feature_mask_off, true, adaptive, normalized, spare>;
     g.update = update<sparse_l2, invariant, sqrt_rate, feature_mask_off, true, adaptive, normalized, spare>;
+    g.multiupdate = multiupdate<sparse_l2, invariant, sqrt_rate, feature_mask_off, true, adaptive, normalized, spare>;
     g.sensitivity = sensitivity<sqrt_rate, feature_mask_off, true, adaptive, normalized, spare>;
     return next;
   }
@@ -1375,6 +1892,7 @@ uint64_t set_learn(VW::workspace& all, VW::reductions::gd& g)
   {
     g.learn = learn<sparse_l2, invariant, sqrt_rate, feature_mask_off, false, adaptive, normalized, spare>;
     g.update = update<sparse_l2, invariant, sqrt_rate, feature_mask_off, false, adaptive, normalized, spare>;
+    g.multiupdate = multiupdate<sparse_l2, invariant, sqrt_rate, feature_mask_off, false, adaptive, normalized, spare>;
     g.sensitivity = sensitivity<sqrt_rate, feature_mask_off, false, adaptive, normalized, spare>;
     return next;
   }
@@ -1479,6 +1997,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
   float local_gravity = 0;
   float local_contraction = 0;
   bool per_model_save_load = false;
+  bool explicit_simd = false;
+  bool async_all_reduce = false;
 
   option_group_definition new_options("[Reduction] Gradient Descent");
   new_options
@@ -1509,7 +2029,16 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
       .add(make_option("per_model_save_load", per_model_save_load)
                .keep()
                .allow_override()
-               .help("Save and load per model state"));
+               .help("Save and load per model state"))
+      .add(make_option("gd_explicit_simd", explicit_simd)
+               .experimental()
+               .help("Use explicit AVX2/AVX-512 kernels for the linear terms of predict and update when the CPU "
+                     "supports them. Sums are reordered, so results can differ slightly from the scalar path"))
+      .add(make_option("async_all_reduce", async_all_reduce)
+               .experimental()
+               .help("In cluster parallel jobs, average the weights of a pass on a background thread while the next "
+                     "pass learns. The average lands one pass late and keeps the updates made in the meantime. "
+                     "Results do not depend on timing. Requires dense weights"));
   options.add_and_parse(new_options);
 
   if (options.was_supplied("l1_state")) { all.sd->gravity = local_gravity; }
@@ -1524,6 +2053,32 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
   g->neg_power_t = -all.update_rule_config.power_t;
   g->sparse_l2 = sparse_l2;
   g->per_model_save_load = per_model_save_load;
+  if (async_all_reduce)
+  {
+    if (all.weights.sparse)
+    {
+      all.logger.err_warn("--async_all_reduce requires dense weights. Averaging synchronously.");
+    }
+    else { g->async_all_reduce = true; }
+  }
+
+  if (explicit_simd)
+  {
+#ifdef VW_FEAT_GD_SIMD_ENABLED
+    if (all.weights.sparse) { all.logger.err_warn("--gd_explicit_simd requires dense weights. Using scalar code path."); }
+    else if (VW::reductions::details::cpu_supports_gd_avx512())
+    {
+      g->simd = VW::reductions::details::gd_simd_type::AVX512;
+    }
+    else if (VW::reductions::details::cpu_supports_gd_avx2())
+    {
+      g->simd = VW::reductions::details::gd_simd_type::AVX2;
+    }
+    else { all.logger.err_warn("System does not support AVX512 or AVX2. Using scalar code path."); }
+#else
+    all.logger.err_warn("This build does not include explicit SIMD kernels for gd. Using scalar code path.");
+#endif
+  }
 
   if (all.update_rule_config.initial_t >
       0)  // for the normalized update: if initial_t is bigger than 1 we interpret this as if we had
@@ -1594,22 +2149,26 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
     {
       g->predict = ::predict<true, true>;
       g->multipredict = ::multipredict<true, true>;
+      g->predict_batch = ::predict_batch<true, true>;
     }
     else
     {
       g->predict = ::predict<true, false>;
       g->multipredict = ::multipredict<true, false>;
+      g->predict_batch = ::predict_batch<true, false>;
     }
   }
   else if (all.output_config.audit || all.output_config.hash_inv)
   {
     g->predict = ::predict<false, true>;
     g->multipredict = ::multipredict<false, true>;
+    g->predict_batch = ::predict_batch<false, true>;
   }
   else
   {
     g->predict = ::predict<false, false>;
     g->multipredict = ::multipredict<false, false>;
+    g->predict_batch = ::predict_batch<false, false>;
   }
 
   uint64_t stride;
@@ -1624,9 +2183,12 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
                .set_learn_returns_prediction(true)
                .set_sensitivity(bare->sensitivity)
                .set_multipredict(bare->multipredict)
+               .set_predict_batch(bare->predict_batch)
                .set_update(bare->update)
+               .set_multiupdate(bare->multiupdate)
                .set_save_load(::save_load)
                .set_end_pass(::end_pass)
+               .set_end_examples(::end_examples)
                .set_merge_with_all(::merge)
                .set_add_with_all(::add)
                .set_subtract_with_all(::subtract)
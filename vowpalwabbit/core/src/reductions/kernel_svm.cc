@@ -17,12 +17,14 @@
 #include "vw/core/numeric_casts.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/version.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_allreduce.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
@@ -31,8 +33,10 @@
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <future>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #define SVM_KER_LIN 0
 #define SVM_KER_RBF 1
@@ -120,6 +124,11 @@ class svm_params;
 static size_t num_kernel_evals = 0;
 static size_t num_cache_evals = 0;
 
+// Examples are only scattered into a dense array while it stays reasonably small, see svm_params::scattered.
+constexpr uint64_t MAX_SCATTERED_FEATURES = static_cast<uint64_t>(1) << 24;
+// Kernel rows are only split over the ksvm threads in ranges of at least this many support vectors.
+constexpr size_t MIN_KERNELS_PER_THREAD = 128;
+
 class svm_example
 {
 public:
@@ -193,6 +202,12 @@ public:
 
   float loss_sum = 0.f;
 
+  // The example whose kernel row is being computed scattered by feature index, zero everywhere else. Only used when
+  // scatter_rows is set, otherwise kernel rows merge the sorted features of both examples.
+  bool scatter_rows = false;
+  std::vector<float> scattered;
+  std::unique_ptr<VW::thread_pool> threads;  // splits kernel rows over support vectors, null when running on one thread
+
   VW::workspace* all = nullptr;  // flatten, parallel
   std::shared_ptr<VW::rand_state> random_state;
 
@@ -218,7 +233,62 @@ svm_example::~svm_example()
   // free_flatten_example(fec);  // free contents of flat example and frees fec.
 }
 
-float kernel_function(const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type);
+float kernel_from_dot_product(
+    float dotprod, const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type);
+
+// Dot product of fs with an example scattered into dense. Flattened features have sorted unique indices, so the
+// products are summed in the same order as features_dot_product does.
+float scattered_dot_product(const VW::features& fs, const float* dense)
+{
+  const float* values = fs.values.data();
+  const VW::feature_index* indices = fs.indices.data();
+  float dotprod = 0.f;
+  for (size_t i = 0; i < fs.size(); i++) { dotprod += values[i] * dense[indices[i]]; }
+  return dotprod;
+}
+
+// Kernel values of ex against the support vectors in [begin, end), written to row.
+void compute_kernel_row(svm_params& params, const flat_example& ex, size_t begin, size_t end, float* row)
+{
+  const svm_model& model = *params.model;
+  if (params.scatter_rows)
+  {
+    if (params.scattered.empty()) { params.scattered.resize(params.all->length()); }
+    for (size_t i = 0; i < ex.fs.size(); i++) { params.scattered[ex.fs.indices[i]] = ex.fs.values[i]; }
+  }
+
+  auto compute_range = [&params, &model, &ex, begin, row](size_t first, size_t last)
+  {
+    for (size_t i = first; i < last; i++)
+    {
+      const flat_example& sv = model.support_vec[i]->ex;
+      const float dotprod = params.scatter_rows ? scattered_dot_product(sv.fs, params.scattered.data())
+                                                : VW::features_dot_product(ex.fs, sv.fs);
+      row[i - begin] = kernel_from_dot_product(dotprod, &ex, &sv, params.kernel_params, params.kernel_type);
+    }
+  };
+
+  // Every value only depends on its own support vector, so the split does not change the results.
+  const size_t ranges =
+      params.threads == nullptr ? 1 : std::min(params.threads->size(), (end - begin) / MIN_KERNELS_PER_THREAD);
+  if (ranges <= 1) { compute_range(begin, end); }
+  else
+  {
+    std::vector<std::future<void>> futures;
+    futures.reserve(ranges);
+    for (size_t range = 0; range < ranges; range++)
+    {
+      futures.push_back(params.threads->submit(compute_range, begin + (end - begin) * range / ranges,
+          begin + (end - begin) * (range + 1) / ranges));
+    }
+    for (auto& future : futures) { future.get(); }
+  }
+
+  if (params.scatter_rows)
+  {
+    for (size_t i = 0; i < ex.fs.size(); i++) { params.scattered[ex.fs.indices[i]] = 0.f; }
+  }
+}
 
 int svm_example::compute_kernels(svm_params& params)
 {
@@ -232,13 +302,10 @@ int svm_example::compute_kernels(svm_params& params)
     // if(params->curcache + n > params->maxcache)
     // trim_cache(params);
     num_kernel_evals += krow.size();
-    for (size_t i = krow.size(); i < n; i++)
-    {
-      svm_example* sec = model->support_vec[i];
-      float kv = kernel_function(&ex, &(sec->ex), params.kernel_params, params.kernel_type);
-      krow.push_back(kv);
-      alloc += 1;
-    }
+    const size_t begin = krow.size();
+    krow.resize(n);
+    compute_kernel_row(params, ex, begin, n, krow.begin() + begin);
+    alloc += static_cast<int>(n - begin);
   }
   else { num_cache_evals += n; }
   return alloc;
@@ -359,28 +426,24 @@ void save_load(svm_params& params, VW::io_buf& model_file, bool read, bool text)
   save_load_svm_model(params, model_file, read, text);
 }
 
-float poly_kernel(const flat_example* fec1, const flat_example* fec2, int power)
-{
-  float dotprod = VW::features_dot_product(fec1->fs, fec2->fs);
-  return static_cast<float>(std::pow(1 + dotprod, power));
-}
+float poly_kernel(float dotprod, int power) { return static_cast<float>(std::pow(1 + dotprod, power)); }
 
-float rbf_kernel(const flat_example* fec1, const flat_example* fec2, float bandwidth)
+float rbf_kernel(float dotprod, const flat_example* fec1, const flat_example* fec2, float bandwidth)
 {
-  float dotprod = VW::features_dot_product(fec1->fs, fec2->fs);
   return expf(-(fec1->total_sum_feat_sq + fec2->total_sum_feat_sq - 2 * dotprod) * bandwidth);
 }
 
-float kernel_function(const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type)
+float kernel_from_dot_product(
+    float dotprod, const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type)
 {
   switch (kernel_type)
   {
     case SVM_KER_RBF:
-      return rbf_kernel(fec1, fec2, *(static_cast<float*>(params)));
+      return rbf_kernel(dotprod, fec1, fec2, *(static_cast<float*>(params)));
     case SVM_KER_POLY:
-      return poly_kernel(fec1, fec2, *(static_cast<int*>(params)));
+      return poly_kernel(dotprod, *(static_cast<int*>(params)));
     case SVM_KER_LIN:
-      return VW::features_dot_product(fec1->fs, fec2->fs);
+      return dotprod;
   }
   return 0;
 }
@@ -792,6 +855,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   uint64_t pool_size;
   uint64_t reprocess;
   uint64_t subsample;
+  uint64_t threads;
 
   bool ksvm = false;
 
@@ -808,13 +872,19 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
                .one_of({"linear", "rbf", "poly"})
                .help("Type of kernel (linear, rbf, poly)"))
       .add(make_option("bandwidth", bandwidth).keep().default_value(1.f).help("Bandwidth of rbf kernel"))
-      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"));
+      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"))
+      .add(make_option("ksvm_threads", threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads computing the kernel values of an example against the support vectors"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
   params->pool_size = VW::cast_to_smaller_type<size_t>(pool_size);
   params->reprocess = VW::cast_to_smaller_type<size_t>(reprocess);
   params->subsample = VW::cast_to_smaller_type<size_t>(subsample);
+  if (threads == 0) { THROW("ksvm_threads should be positive") }
+  if (threads > 1) { params->threads = VW::make_unique<VW::thread_pool>(VW::cast_to_smaller_type<size_t>(threads)); }
 
   std::string loss_function = "hinge";
   float loss_parameter = 0.0;
@@ -864,6 +934,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   else { params->kernel_type = SVM_KER_LIN; }
 
   params->all->weights.stride_shift(0);
+  // Scattering the example costs an array of the size of the (unused) dense weights, it is skipped with sparse weights.
+  params->scatter_rows = !all.weights.sparse && all.length() <= MAX_SCATTERED_FEATURES;
 
   auto l = make_bottom_learner(std::move(params), learn, predict, stack_builder.get_setupfn_name(kernel_svm_setup),
       VW::prediction_type_t::SCALAR, VW::label_type_t::SIMPLE)
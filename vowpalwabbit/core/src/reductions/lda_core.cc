@@ -4,6 +4,7 @@
 
 #include "vw/core/reductions/lda_core.h"
 
+#include "details/lda/lda_simd.h"
 #include "vw/common/future_compat.h"
 #include "vw/common/random.h"
 #include "vw/core/crossplat_compat.h"
@@ -28,6 +29,7 @@ VW_WARNING_STATE_POP
 #include "vw/core/reductions/gd.h"
 #include "vw/core/reductions/mwt.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
@@ -42,6 +44,8 @@ VW_WARNING_STATE_POP
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
+#include <memory>
 #include <numeric>
 #include <queue>
 #include <vector>
@@ -58,6 +62,22 @@ enum class lda_math_mode : int
   USE_FAST_APPROX
 };
 
+enum class lda_simd_type
+{
+  SSE,
+  AVX2,
+  AVX512
+};
+
+// Buffers of the E-step of one document. Every thread running E-steps has its own.
+class lda_scratch
+{
+public:
+  VW::v_array<float> new_gamma;
+  VW::v_array<float> old_gamma;
+  VW::v_array<float> Elogtheta;  // NOLINT
+};
+
 class index_feature
 {
 public:
@@ -76,8 +96,11 @@ public:
   float lda_epsilon = 0.f;
   size_t minibatch = 0;
   lda_math_mode mmode;
+  lda_simd_type simd = lda_simd_type::SSE;  // kernels for math-mode 0
 
-  VW::v_array<float> Elogtheta;  // NOLINT
+  std::vector<lda_scratch> scratch;          // one per E-step thread
+  std::unique_ptr<VW::thread_pool> threads;  // runs the E-steps of a minibatch, null when running on one thread
+  std::vector<float> scores;                 // per document of the minibatch
   VW::v_array<float> decay_levels;
   VW::v_array<float> total_new;
   VW::v_array<float> total_lambda;
@@ -606,6 +629,18 @@ void lda::expdigammify(VW::workspace& all_, float* gamma)
       ldamath::expdigammify<float, lda_math_mode::USE_PRECISE>(all_, gamma, UNDERFLOW_THRESHOLD, 0.0f);
       break;
     case lda_math_mode::USE_SIMD:
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+      if (simd == lda_simd_type::AVX512)
+      {
+        VW::reductions::details::lda_expdigammify_avx512(gamma, topics, UNDERFLOW_THRESHOLD);
+        break;
+      }
+      if (simd == lda_simd_type::AVX2)
+      {
+        VW::reductions::details::lda_expdigammify_avx2(gamma, topics, UNDERFLOW_THRESHOLD);
+        break;
+      }
+#endif
       ldamath::expdigammify<float, lda_math_mode::USE_SIMD>(all_, gamma, UNDERFLOW_THRESHOLD, 0.0f);
       break;
     default:
@@ -625,6 +660,18 @@ void lda::expdigammify_2(VW::workspace& all_, float* gamma, float* norm)
       ldamath::expdigammify_2<float, lda_math_mode::USE_PRECISE>(all_, gamma, norm, UNDERFLOW_THRESHOLD);
       break;
     case lda_math_mode::USE_SIMD:
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+      if (simd == lda_simd_type::AVX512)
+      {
+        VW::reductions::details::lda_expdigammify_2_avx512(gamma, norm, topics, UNDERFLOW_THRESHOLD);
+        break;
+      }
+      if (simd == lda_simd_type::AVX2)
+      {
+        VW::reductions::details::lda_expdigammify_2_avx2(gamma, norm, topics, UNDERFLOW_THRESHOLD);
+        break;
+      }
+#endif
       ldamath::expdigammify_2<float, lda_math_mode::USE_SIMD>(all_, gamma, norm, UNDERFLOW_THRESHOLD);
       break;
     default:
@@ -679,21 +726,16 @@ static inline float find_cw(lda& l, float* u_for_w, float* v)
   return 1.0f / std::inner_product(u_for_w, u_for_w + l.topics, v, 0.0f);
 }
 
-namespace
-{
-// Effectively, these are static and not visible outside the compilation unit.
-VW::v_array<float> new_gamma;
-VW::v_array<float> old_gamma;
-}  // namespace
-
 // Returns an estimate of the part of the variational bound that
 // doesn't have to do with beta for the entire corpus for the current
 // setting of lambda based on the document passed in. The value is
 // divided by the total number of words in the document This can be
 // used as a (possibly very noisy) estimate of held-out likelihood.
-float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec, float)
+float lda_loop(lda& l, lda_scratch& scratch, float* v, VW::example* ec, float)
 {
   parameters& weights = l.all->weights;
+  auto& new_gamma = scratch.new_gamma;
+  auto& old_gamma = scratch.old_gamma;
   new_gamma.clear();
   old_gamma.clear();
 
@@ -735,7 +777,7 @@ float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec,
   ec->pred.scalars.resize(l.topics);
   memcpy(ec->pred.scalars.begin(), new_gamma.begin(), l.topics * sizeof(float));
 
-  score += theta_kl(l, Elogtheta, new_gamma.begin());
+  score += theta_kl(l, scratch.Elogtheta, new_gamma.begin());
 
   return score / doc_length;
 }
@@ -906,16 +948,39 @@ void learn_batch(lda& l, std::vector<example*>& batch)
     l.expdigammify_2(*l.all, u_for_w, l.digammas.begin());
   }
 
+  // The E-steps of the documents only read the weights, so they can run in parallel. Everything else is merged in
+  // document order afterwards.
+  l.scores.resize(batch_size);
+  auto e_step = [&l, &batch](size_t thread, size_t begin, size_t end)
+  {
+    for (size_t d = begin; d < end; d++)
+    {
+      l.scores[d] = lda_loop(l, l.scratch[thread], &(l.v[d * l.all->reduction_state.lda]), batch[d],
+          l.all->update_rule_config.power_t);
+    }
+  };
+  if (l.threads == nullptr || batch_size == 1) { e_step(0, 0, batch_size); }
+  else
+  {
+    const size_t ranges = std::min(l.scratch.size(), batch_size);
+    std::vector<std::future<void>> futures;
+    futures.reserve(ranges);
+    for (size_t range = 0; range < ranges; range++)
+    {
+      futures.push_back(
+          l.threads->submit(e_step, range, batch_size * range / ranges, batch_size * (range + 1) / ranges));
+    }
+    for (auto& future : futures) { future.get(); }
+  }
+
   for (size_t d = 0; d < batch_size; d++)
   {
-    float score =
-        lda_loop(l, l.Elogtheta, &(l.v[d * l.all->reduction_state.lda]), batch[d], l.all->update_rule_config.power_t);
     if (l.all->output_config.audit) { VW::details::print_audit_features(*l.all, *batch[d]); }
     // If the doc is empty, give it loss of 0.
     if (l.doc_lengths[d] > 0)
     {
-      l.all->sd->sum_loss -= score;
-      l.all->sd->sum_loss_since_last_dump -= score;
+      l.all->sd->sum_loss -= l.scores[d];
+      l.all->sd->sum_loss_since_last_dump -= l.scores[d];
     }
   }
 
@@ -1312,6 +1377,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
   int64_t math_mode;
   uint64_t topics;
   uint64_t minibatch;
+  uint64_t threads;
+  bool explicit_simd = false;
   new_options.add(make_option("lda", topics).keep().necessary().help("Run lda with <int> topics"))
       .add(make_option("lda_alpha", ld->lda_alpha)
                .keep()
@@ -1328,6 +1395,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
                .default_value(static_cast<int64_t>(lda_math_mode::USE_SIMD))
                .one_of({0, 1, 2})
                .help("Math mode: 0=simd, 1=accuracy, 2=fast-approx"))
+      .add(make_option("lda_explicit_simd", explicit_simd)
+               .experimental()
+               .help("With math-mode 0, use AVX2/AVX-512 kernels for the digamma and exp evaluations when the CPU "
+                     "supports them. Results can differ slightly from the SSE kernels"))
+      .add(make_option("lda_threads", threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads running the E-steps of the documents of a minibatch. Needs dense weights"))
       .add(make_option("metrics", ld->compute_coherence_metrics).help("Compute coherence metrics for LDA topics"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
@@ -1337,6 +1412,30 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
   ld->topics = VW::cast_to_smaller_type<size_t>(topics);
   ld->minibatch = VW::cast_to_smaller_type<size_t>(minibatch);
 
+  if (threads == 0) { THROW("lda_threads should be positive") }
+  if (threads > 1 && all.weights.sparse)
+  {
+    all.logger.err_warn("--lda_threads requires dense weights. Running the E-steps on one thread.");
+    threads = 1;
+  }
+  ld->scratch.resize(VW::cast_to_smaller_type<size_t>(threads));
+  if (threads > 1) { ld->threads = VW::make_unique<VW::thread_pool>(ld->scratch.size()); }
+
+  if (explicit_simd)
+  {
+#ifdef VW_FEAT_LDA_SIMD_ENABLED
+    if (ld->mmode != lda_math_mode::USE_SIMD)
+    {
+      all.logger.err_warn("--lda_explicit_simd only applies to math-mode 0.");
+    }
+    else if (VW::reductions::details::cpu_supports_lda_avx512()) { ld->simd = lda_simd_type::AVX512; }
+    else if (VW::reductions::details::cpu_supports_lda_avx2()) { ld->simd = lda_simd_type::AVX2; }
+    else { all.logger.err_warn("System does not support AVX512 or AVX2. Using SSE kernels."); }
+#else
+    all.logger.err_warn("This build does not include explicit SIMD kernels for lda. Using SSE kernels.");
+#endif
+  }
+
   all.reduction_state.lda = static_cast<uint32_t>(ld->topics);
   ld->sorted_features = std::vector<index_feature>();
   ld->total_lambda_init = false;
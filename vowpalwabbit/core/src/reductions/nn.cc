@@ -274,6 +274,7 @@ void predict_or_learn_multi(nn& n, learner& base, VW::example& ec)
       }
     }
 
+    n.output_layer.interaction_expansions.invalidate();
     loss_function_swap_guard_converse_block.do_swap();
     n.all->set_minmax = save_set_minmax;
     n.all->sd->min_label = save_min_label;
@@ -296,6 +297,8 @@ void predict_or_learn_multi(nn& n, learner& base, VW::example& ec)
       VW::features save_nn_output_namespace = std::move(ec.feature_space[VW::details::NN_OUTPUT_NAMESPACE]);
       ec.feature_space[VW::details::NN_OUTPUT_NAMESPACE] =
           n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE];
+      // The hidden unit values change in place from one example to the next.
+      ec.interaction_expansions.invalidate();
 
       if (is_learn) { base.learn(ec, n.k); }
       else { base.predict(ec, n.k); }
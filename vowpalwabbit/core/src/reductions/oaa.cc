@@ -21,6 +21,7 @@
 #include <cmath>
 #include <cstddef>
 #include <sstream>
+#include <vector>
 
 using namespace VW::config;
 
@@ -36,6 +37,7 @@ public:
   uint64_t k = 0;
   VW::workspace* all = nullptr;         // for raw
   VW::polyprediction* pred = nullptr;   // for multipredict
+  std::vector<float> labels;            // for multiupdate
   uint64_t num_subsample = 0;           // for randomized subsampling, how many negatives to draw?
   uint32_t* subsample_order = nullptr;  // for randomized subsampling, in what order should we touch classes
   size_t subsample_id = 0;              // for randomized subsampling, where do we live in the list
@@ -153,13 +155,12 @@ void learn(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
   for (uint32_t i = 0; i < o.k; i++)
   {
     uint32_t lbl = (o.indexing == 0) ? i : i + 1;
-    ec.l.simple.label = (mc_label_data.label == lbl) ? 1.f : -1.f;
-    // The following is an unfortunate loss of abstraction
-    // Downstream reduction (gd.update) uses the prediction
-    // from here
-    ec.pred.scalar = o.pred[i].scalar;
-    base.update(ec, i);
+    o.labels[i] = (mc_label_data.label == lbl) ? 1.f : -1.f;
   }
+  // The following is an unfortunate loss of abstraction
+  // Downstream reduction (gd.update) uses the prediction
+  // from here
+  base.multiupdate(ec, 0, o.k, o.labels.data(), o.pred);
 
   // Restore label
   ec.l.multi = mc_label_data;
@@ -350,6 +351,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
 
   data->all = &all;
   data->pred = VW::details::calloc_or_throw<VW::polyprediction>(data->k);
+  data->labels.resize(data->k);
   data->subsample_order = nullptr;
   data->subsample_id = 0;
   if (data->num_subsample > 0)
@@ -28,6 +28,20 @@ public:
   VW::workspace* all;
 };  // for set_minmax, loss
 
+template <float (*link)(float in)>
+void score(scorer& s, VW::example& ec)
+{
+  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
+  {
+    ec.loss = s.all->loss_config.loss->get_loss(s.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
+  }
+
+  ec.pred.scalar = link(ec.pred.scalar);
+  VW_DBG(ec) << "ex#= " << ec.example_counter << ", offset=" << ec.ft_offset << ", lbl=" << ec.l.simple.label
+             << ", pred= " << ec.pred.scalar << ", wt=" << ec.weight << ", gd.raw=" << ec.partial_prediction
+             << ", loss=" << ec.loss << std::endl;
+}
+
 template <bool is_learn, float (*link)(float in)>
 void predict_or_learn(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
 {
@@ -38,15 +52,14 @@ void predict_or_learn(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
   if (learn) { base.learn(ec); }
   else { base.predict(ec); }
 
-  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
-  {
-    ec.loss = s.all->loss_config.loss->get_loss(s.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
-  }
+  score<link>(s, ec);
+}
 
-  ec.pred.scalar = link(ec.pred.scalar);
-  VW_DBG(ec) << "ex#= " << ec.example_counter << ", offset=" << ec.ft_offset << ", lbl=" << ec.l.simple.label
-             << ", pred= " << ec.pred.scalar << ", wt=" << ec.weight << ", gd.raw=" << ec.partial_prediction
-             << ", loss=" << ec.loss << std::endl;
+template <float (*link)(float in)>
+void link_predict_batch(scorer& s, VW::LEARNER::learner& base, VW::example* const* examples, size_t count)
+{
+  base.predict_batch(examples, count);
+  for (size_t k = 0; k < count; k++) { score<link>(s, *examples[k]); }
 }
 
 template <float (*link)(float in)>
@@ -67,6 +80,16 @@ void update(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
              << ", loss=" << ec.loss << std::endl;
 }
 
+void multiupdate(scorer& s, VW::LEARNER::learner& base, VW::example& ec, size_t count, size_t /*step*/,
+    const float* labels, const VW::polyprediction* pred)
+{
+  if (s.all->set_minmax)
+  {
+    for (size_t c = 0; c < count; c++) { s.all->set_minmax(labels[c]); }
+  }
+  base.multiupdate(ec, 0, count, labels, pred);
+}
+
 // y = f(x) -> [0, 1]
 inline float logistic(float in) { return 1.f / (1.f + VW::details::correctedExp(-in)); }
 
@@ -95,7 +118,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
   using predict_or_learn_fn_t = void (*)(scorer&, VW::LEARNER::learner&, VW::example&);
   using multipredict_fn_t =
       void (*)(scorer&, VW::LEARNER::learner&, VW::example&, size_t, size_t, VW::polyprediction*, bool);
+  using predict_batch_fn_t = void (*)(scorer&, VW::LEARNER::learner&, VW::example* const*, size_t);
   multipredict_fn_t multipredict_f = multipredict<id>;
+  predict_batch_fn_t predict_batch_f = link_predict_batch<id>;
   predict_or_learn_fn_t learn_fn;
   predict_or_learn_fn_t predict_fn;
   std::string name = stack_builder.get_setupfn_name(scorer_setup);
@@ -112,6 +137,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, logistic>;
     name += "-logistic";
     multipredict_f = multipredict<logistic>;
+    predict_batch_f = link_predict_batch<logistic>;
   }
   else if (link == "glf1")
   {
@@ -119,6 +145,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, glf1>;
     name += "-glf1";
     multipredict_f = multipredict<glf1>;
+    predict_batch_f = link_predict_batch<glf1>;
   }
   else if (link == "poisson")
   {
@@ -126,6 +153,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, expf>;
     name += "-poisson";
     multipredict_f = multipredict<expf>;
+    predict_batch_f = link_predict_batch<expf>;
   }
   else { THROW("Unknown link function: " << link); }
 
@@ -139,7 +167,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
                .set_input_prediction_type(VW::prediction_type_t::SCALAR)
                .set_output_prediction_type(VW::prediction_type_t::SCALAR)
                .set_multipredict(multipredict_f)
+               .set_predict_batch(predict_batch_f)
                .set_update(update)
+               .set_multiupdate(multiupdate)
                .build();
 
   return l;
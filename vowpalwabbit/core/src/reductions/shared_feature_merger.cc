@@ -30,8 +30,26 @@ public:
   std::unique_ptr<sfm_metrics> metrics;
   VW::label_type_t label_type = VW::label_type_t::CB;
   bool store_shared_ex_in_reduction_features = false;
+  bool cache_shared_score = false;
+  uint64_t multi_ex_count = 0;
 };
 
+// Tells the base learners which features of action were appended from shared, see --cache_shared_score. Must be called
+// right after appending, while the shared features are still at the end of every namespace.
+void mark_appended_features(VW::example& action, const VW::example& shared, uint64_t multi_ex_id)
+{
+  auto& red_features = action.ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>();
+  red_features.shared_example = &shared;
+  red_features.multi_ex_id = multi_ex_id;
+  red_features.appended.clear();
+  for (VW::namespace_index idx : shared.indices)
+  {
+    if (idx == VW::details::CONSTANT_NAMESPACE) { continue; }
+    const size_t end = action.feature_space[idx].size();
+    red_features.appended.push_back({idx, end - shared.feature_space[idx].size(), end});
+  }
+}
+
 template <bool is_learn, bool is_cb_with_observations>
 void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex& ec_seq)
 {
@@ -39,6 +57,7 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
 
   VW::multi_ex::value_type shared_example = nullptr;
   const bool store_shared_ex_in_reduction_features = data.store_shared_ex_in_reduction_features;
+  const bool cache_shared_score = data.cache_shared_score;
 
   const bool has_example_header = VW::LEARNER::ec_is_example_header(*ec_seq[0], data.label_type);
 
@@ -61,6 +80,19 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
     std::swap(ec_seq[0]->pred, shared_example->pred);
     std::swap(ec_seq[0]->tag, shared_example->tag);
     std::swap(ec_seq[0]->ex_reduction_features, shared_example->ex_reduction_features);
+    if (cache_shared_score)
+    {
+      // Recorded after the swap so that the first action keeps them.
+      const uint64_t multi_ex_id = ++data.multi_ex_count;
+      for (auto& example : ec_seq)
+      {
+        if (is_cb_with_observations)
+        {
+          if (example->l.cb_with_observations.is_observation) { continue; }
+        }
+        mark_appended_features(*example, *shared_example, multi_ex_id);
+      }
+    }
     if (store_shared_ex_in_reduction_features)
     {
       auto& red_features =
@@ -71,12 +103,16 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
 
   // Guard example state restore against throws
   auto restore_guard = VW::scope_exit(
-      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features]
+      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features, cache_shared_score]
       {
         if (has_example_header)
         {
           for (auto& example : ec_seq)
           {
+            if (cache_shared_score)
+            {
+              example->ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>().clear();
+            }
             if (is_cb_with_observations)
             {
               if (example->l.cb_with_observations.is_observation) { continue; }
@@ -124,6 +160,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::shared_feature_merger_setu
   VW::config::options_i& options = *stack_builder.get_options();
   VW::workspace& all = *stack_builder.get_all_pointer();
 
+  bool cache_shared_score = false;
+  VW::config::option_group_definition new_options("[Reduction] Shared Feature Merger");
+  new_options.add(VW::config::make_option("cache_shared_score", cache_shared_score)
+                      .help("Score the linear terms of the shared features once per multi example instead of once per "
+                            "action. Only used by gd when predicting without --l1 or --audit")
+                      .experimental());
+  options.add_and_parse(new_options);
+
   auto base = stack_builder.setup_base_learner();
   if (base == nullptr) { return nullptr; }
   std::set<label_type_t> sfm_labels = {label_type_t::CB, label_type_t::CS, label_type_t::CB_WITH_OBSERVATIONS};
@@ -132,6 +176,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::shared_feature_merger_setu
   auto data = VW::make_unique<sfm_data>();
   if (all.output_runtime.global_metrics.are_metrics_enabled()) { data->metrics = VW::make_unique<sfm_metrics>(); }
   if (options.was_supplied("large_action_space")) { data->store_shared_ex_in_reduction_features = true; }
+  data->cache_shared_score = cache_shared_score;
 
   auto multi_base = VW::LEARNER::require_multiline(base);
   data->label_type = base->get_input_label_type();
@@ -313,6 +313,39 @@ std::unique_ptr<VW::workspace> VW::seed_vw_model(VW::workspace& vw_model, const
   return new_model;
 }
 
+std::unique_ptr<VW::workspace> VW::details::create_replica(
+    VW::workspace& master, const std::set<std::string>& excluded_options)
+{
+  // Options that refer to input, output or the driver only make sense for the master. Weight initialization is
+  // skipped as well since the replica's own weights are replaced and should never be touched.
+  static const std::set<std::string> MASTER_ONLY_OPTIONS = {"data", "daemon", "foreground", "port", "num_children",
+      "pid_file", "port_file", "cache", "cache_file", "kill_cache", "compressed", "no_stdin", "passes",
+      "initial_regressor", "input_feature_regularizer", "initial_weight", "random_weights", "normal_weights",
+      "truncated_normal_weights", "predictions", "raw_predictions", "final_regressor", "readable_model", "invert_hash",
+      "save_per_pass", "output_feature_regularizer_binary", "output_feature_regularizer_text", "audit_regressor",
+      "quiet", "progress", "log_output", "learner_threads", "parse_threads"};
+
+  config::cli_options_serializer serializer;
+  for (auto const& option : master.options->get_all_options())
+  {
+    if (master.options->was_supplied(option->m_name) && MASTER_ONLY_OPTIONS.count(option->m_name) == 0 &&
+        excluded_options.count(option->m_name) == 0)
+    {
+      serializer.add(*option);
+    }
+  }
+  auto args = VW::split_command_line(serializer.str());
+  args.emplace_back("--no_stdin");
+  args.emplace_back("--quiet");
+
+  auto replica =
+      VW::initialize(VW::make_unique<config::options_cli>(args), nullptr, nullptr, nullptr, &master.logger);
+  replica->weights.shallow_copy(master.weights);
+  replica->sd = master.sd;
+  replica->update_rule_config.eta = master.update_rule_config.eta;
+  return replica;
+}
+
 VW::workspace* VW::initialize_with_builder(const std::string& s, io_buf* model, bool skip_model_load,
     VW::trace_message_t trace_listener, void* trace_context, std::unique_ptr<VW::setup_base_i> setup_base)
 {
@@ -870,6 +903,11 @@ void VW::add_label(VW::example* ec, float label, float weight, float base)
   ec->weight = weight;
 }
 
+void VW::predict_batch(VW::workspace& all, example* const* examples, size_t count)
+{
+  all.predict_batch(examples, count);
+}
+
 // notify VW that you are done with the example.
 void VW::finish_example(VW::workspace& all, example& ec)
 {
@@ -896,10 +934,21 @@ void VW::finish_example(VW::workspace& all, multi_ex& ec_seq)
 
 void VW::empty_example(VW::workspace& /*all*/, example& ec)
 {
-  for (features& fs : ec) { fs.clear(); }
+  // Pooled examples keep the buffers of their features between uses, so that once every slot has seen a typical
+  // example parsing into it no longer allocates. Buffers grown by an outlier are released instead of being pinned.
+  for (features& fs : ec)
+  {
+    if (fs.values.capacity() > details::MAX_RETAINED_FEATURES)
+    {
+      fs.clear();
+      fs.values.shrink_to_fit();
+      fs.indices.shrink_to_fit();
+    }
+    else { fs.clear_noshrink(); }
+  }
 
-  ec.indices.clear();
-  ec.tag.clear();
+  ec.indices.clear_noshrink();
+  ec.tag.clear_noshrink();
   ec.sorted = false;
   ec.end_pass = false;
   ec.is_newline = false;
@@ -907,6 +956,7 @@ void VW::empty_example(VW::workspace& /*all*/, example& ec)
   ec.num_features_from_interactions = 0;
   ec.feature_space_hash = 0;
   ec.is_set_feature_space_hash = false;
+  ec.interaction_expansions.invalidate();
 }
 
 void VW::move_feature_namespace(example* dst, example* src, namespace_index c)
@@ -0,0 +1,163 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/accumulate.h"
+
+#include "vw/allreduce/allreduce.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/global_data.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr size_t NODES = 3;
+constexpr uint64_t LENGTH = 1 << 10;
+
+// Value node k holds at index i before accumulating.
+float local_value(size_t node, uint64_t i, uint64_t touched_every)
+{
+  if ((i + node) % touched_every != 0) { return 0.f; }
+  return static_cast<float>(node + 1) * 0.25f + static_cast<float>(i) * 0.001f;
+}
+
+std::vector<std::unique_ptr<VW::workspace>> make_nodes(const std::vector<std::string>& args, uint64_t touched_every)
+{
+  std::vector<std::unique_ptr<VW::workspace>> nodes;
+  auto* root = new VW::all_reduce_threads(NODES, 0, true);
+  for (size_t node = 0; node < NODES; node++)
+  {
+    std::vector<std::string> node_args = {"--quiet", "-b", "10"};
+    node_args.insert(node_args.end(), args.begin(), args.end());
+    nodes.push_back(VW::initialize(VW::make_unique<VW::config::options_cli>(node_args)));
+    auto& all = *nodes.back();
+    all.runtime_config.selected_all_reduce_type = VW::all_reduce_type::THREAD;
+    all.runtime_state.all_reduce.reset(node == 0 ? root : new VW::all_reduce_threads(root, NODES, node, true));
+    for (uint64_t i = 0; i < LENGTH; i++)
+    {
+      const float value = local_value(node, i, touched_every);
+      if (value == 0.f) { continue; }
+      all.weights.strided_index(i) = value;
+    }
+  }
+  return nodes;
+}
+
+void run_on_all_nodes(std::vector<std::unique_ptr<VW::workspace>>& nodes, void (*f)(VW::workspace&))
+{
+  std::vector<std::thread> threads;
+  for (auto& node : nodes) { threads.emplace_back(f, std::ref(*node)); }
+  for (auto& thread : threads) { thread.join(); }
+}
+
+void check_sums(std::vector<std::unique_ptr<VW::workspace>>& nodes, uint64_t touched_every, float divisor)
+{
+  for (uint64_t i = 0; i < LENGTH; i++)
+  {
+    float expected = 0.f;
+    for (size_t node = 0; node < NODES; node++) { expected += local_value(node, i, touched_every); }
+    expected /= divisor;
+    const float first = nodes[0]->weights.strided_index(i);
+    EXPECT_NEAR(first, expected, 1e-5f) << "index " << i;
+    // All nodes have to agree exactly, otherwise they drift apart over passes.
+    for (size_t node = 1; node < NODES; node++) { EXPECT_EQ(nodes[node]->weights.strided_index(i), first); }
+  }
+}
+
+void accumulate_weights(VW::workspace& all) { VW::details::accumulate(all, all.weights, 0); }
+void accumulate_avg_weights(VW::workspace& all) { VW::details::accumulate_avg(all, all.weights, 0); }
+}  // namespace
+
+TEST(Accumulate, SparseAllReduceSumsNonZeroEntries)
+{
+  const std::vector<std::vector<std::string>> configs = {
+      {"--sparse_all_reduce"}, {"--sparse_all_reduce", "--sparse_weights"}, {}};
+  for (const auto& args : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(args));
+    auto nodes = make_nodes(args, 7);
+    run_on_all_nodes(nodes, accumulate_weights);
+    check_sums(nodes, 7, 1.f);
+  }
+}
+
+TEST(Accumulate, SparseAllReduceAveragesNonZeroEntries)
+{
+  const std::vector<std::vector<std::string>> configs = {
+      {"--sparse_all_reduce"}, {"--sparse_all_reduce", "--sparse_weights"}};
+  for (const auto& args : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(args));
+    auto nodes = make_nodes(args, 5);
+    run_on_all_nodes(nodes, accumulate_avg_weights);
+    check_sums(nodes, 5, static_cast<float>(NODES));
+  }
+}
+
+TEST(Accumulate, SparseAllReduceFallsBackToDenseForDenseVectors)
+{
+  auto nodes = make_nodes({"--sparse_all_reduce"}, 1);
+  run_on_all_nodes(nodes, accumulate_weights);
+  check_sums(nodes, 1, 1.f);
+}
+
+TEST(Accumulate, AsyncAverageKeepsUpdatesMadeWhileReducing)
+{
+  for (const bool adaptive : {false, true})
+  {
+    SCOPED_TRACE(adaptive);
+    // Two clusters see the same weights. One averages synchronously, the other one asynchronously and learns in the
+    // meantime, which has to end up with the synchronous average plus the local updates.
+    auto sync_nodes = make_nodes({}, 3);
+    auto async_nodes = make_nodes({}, 3);
+    for (auto* nodes : {&sync_nodes, &async_nodes})
+    {
+      for (auto& node : *nodes)
+      {
+        node->weights.adaptive = adaptive;
+        if (!adaptive) { continue; }
+        for (uint64_t i = 0; i < LENGTH; i++) { (&node->weights.strided_index(i))[1] = 1.f + (i % 3); }
+      }
+    }
+    run_on_all_nodes(sync_nodes,
+        [](VW::workspace& all)
+        {
+          if (all.weights.adaptive) { VW::details::accumulate_weighted_avg(all, all.weights); }
+          else { VW::details::accumulate_avg(all, all.weights, 0); }
+        });
+
+    std::vector<VW::details::async_accumulator> accumulators(NODES);
+    for (size_t node = 0; node < NODES; node++)
+    {
+      accumulators[node].start(*async_nodes[node], async_nodes[node]->weights);
+    }
+    for (size_t node = 0; node < NODES; node++)
+    {
+      for (uint64_t i = 0; i < LENGTH; i += 11) { async_nodes[node]->weights.strided_index(i) += 0.5f; }
+    }
+    for (size_t node = 0; node < NODES; node++)
+    {
+      accumulators[node].finish(async_nodes[node]->weights);
+      EXPECT_FALSE(accumulators[node].pending());
+    }
+
+    for (size_t node = 0; node < NODES; node++)
+    {
+      for (uint64_t i = 0; i < LENGTH; i++)
+      {
+        const float update = i % 11 == 0 ? 0.5f : 0.f;
+        EXPECT_NEAR(async_nodes[node]->weights.strided_index(i), sync_nodes[node]->weights.strided_index(i) + update,
+            1e-5f)
+            << "node " << node << " index " << i;
+      }
+    }
+  }
+}
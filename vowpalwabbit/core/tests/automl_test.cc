@@ -8,8 +8,11 @@
 #include "vw/core/automl_impl.h"
 #include "vw/core/estimators/confidence_sequence_robust.h"
 #include "vw/core/interactions.h"
+#include "vw/core/io_buf.h"
 #include "vw/core/metric_sink.h"
+#include "vw/core/vw.h"
 #include "vw/core/vw_fwd.h"
+#include "vw/test_common/test_common.h"
 
 #include <gtest/gtest.h>
 
@@ -168,6 +171,62 @@ TEST(Automl, SaveLoadWIterations)
   EXPECT_EQ(ctr_no_save, ctr_with_save);
 }
 
+TEST(Automl, ThreadsMatchSerialWIterations)
+{
+  const size_t num_iterations = 1000;
+  const size_t seed = 88;
+  const std::vector<uint64_t> swap_after = {500};
+  std::vector<std::string> args{"--automl", "4", "--priority_type", "favor_popular_namespaces", "--cb_explore_adf",
+      "--quiet", "--epsilon", "0.2", "--fixed_significance_level", "--random_seed", "5", "--default_lease", "10"};
+  // The saved models include the gd state of the challengers, which only their replicas learn.
+  std::vector<std::shared_ptr<std::vector<char>>> models;
+  const auto save_model = [&models](cb_sim&, VW::workspace& all, VW::multi_ex&)
+  {
+    models.push_back(std::make_shared<std::vector<char>>());
+    VW::io_buf io_writer;
+    io_writer.add_file(VW::io::create_vector_writer(models.back()));
+    VW::save_predictor(all, io_writer);
+    io_writer.flush();
+    return true;
+  };
+  callback_map serial_hooks{{num_iterations, save_model}};
+  auto ctr_serial = simulator::_test_helper_hook(args, serial_hooks, num_iterations, seed, swap_after);
+
+  args.insert(args.end(), {"--automl_threads", "3"});
+  callback_map threads_hooks{{num_iterations, save_model}};
+  auto ctr_threads = simulator::_test_helper_hook(args, threads_hooks, num_iterations, seed, swap_after);
+  auto ctr_threads_reloaded = simulator::_test_helper_save_load(args, num_iterations, seed, swap_after, 400);
+
+  EXPECT_EQ(ctr_serial, ctr_threads);
+  EXPECT_EQ(ctr_serial, ctr_threads_reloaded);
+  ASSERT_EQ(models.size(), 2);
+  EXPECT_EQ(*models[0], *models[1]);
+}
+
+TEST(Automl, ThreadsAreNotUsedWithL2)
+{
+  auto vw = VW::initialize(
+      vwtest::make_args("--automl", "4", "--cb_explore_adf", "--quiet", "--automl_threads", "3", "--l2", "0.001"));
+  auto* aml = aml_test::get_automl_data<VW::reductions::automl::one_diff_impl>(*vw);
+  EXPECT_EQ(aml->threads, nullptr);
+}
+
+TEST(Automl, SparseWeightsMatchDenseWIterations)
+{
+  const size_t num_iterations = 1000;
+  const size_t seed = 88;
+  const std::vector<uint64_t> swap_after = {500};
+  callback_map empty_hooks;
+  std::vector<std::string> args{"--automl", "4", "--priority_type", "favor_popular_namespaces", "--cb_explore_adf",
+      "--quiet", "--epsilon", "0.2", "--fixed_significance_level", "--random_seed", "5", "--default_lease", "10"};
+  auto ctr_dense = simulator::_test_helper_hook(args, empty_hooks, num_iterations, seed, swap_after);
+
+  args.emplace_back("--sparse_weights");
+  auto ctr_sparse = simulator::_test_helper_hook(args, empty_hooks, num_iterations, seed, swap_after);
+
+  EXPECT_EQ(ctr_dense, ctr_sparse);
+}
+
 TEST(Automl, Assert0thEventAutomlWIterations)
 {
   const size_t zero = 0;
@@ -0,0 +1,70 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string write_data_file(const std::string& name)
+{
+  const auto file_name = ::testing::TempDir() + name;
+  std::ofstream data(file_name);
+  for (size_t i = 0; i < 500; ++i)
+  {
+    const float label = static_cast<float>(i % 7) * 0.3f - 1.f;
+    data << label << " |f a:" << (label + 1.f) << " b" << i % 13 << " c" << i % 29 << " d:" << (i % 5) * 0.1f << '\n';
+  }
+  return file_name;
+}
+
+std::unique_ptr<VW::workspace> train_with_driver(std::vector<std::string> args, const std::string& cache_file)
+{
+  std::remove(cache_file.c_str());
+  args.insert(args.end(), {"--quiet", "--passes", "6", "--cache_file", cache_file, "--holdout_off", "-b", "12"});
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+  std::remove(cache_file.c_str());
+  return vw;
+}
+}  // namespace
+
+TEST(Bfgs, ThreadsMatchSingleThreadedSweeps)
+{
+  const auto data_file = write_data_file("vw_bfgs_threads.txt");
+  const auto cache_file = ::testing::TempDir() + "vw_bfgs_threads.cache";
+  const std::vector<std::vector<std::string>> configs = {
+      {"--bfgs"}, {"--bfgs", "--mem", "3"}, {"--conjugate_gradient"}, {"--bfgs", "--sparse_weights"}};
+  for (const auto& config : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(config));
+    auto args = config;
+    args.insert(args.end(), {"-d", data_file});
+    auto serial = train_with_driver(args, cache_file);
+    args.insert(args.end(), {"--bfgs_threads", "3"});
+    auto threaded = train_with_driver(args, cache_file);
+
+    // Only the order of the dot product sums differs.
+    EXPECT_NEAR(threaded->sd->sum_loss, serial->sd->sum_loss, 1e-3 * serial->sd->sum_loss);
+    for (uint64_t i = 0; i < serial->length(); i++)
+    {
+      EXPECT_NEAR(threaded->weights.strided_index(i), serial->weights.strided_index(i), 1e-3f) << "index " << i;
+    }
+    serial->finish();
+    threaded->finish();
+  }
+  std::remove(data_file.c_str());
+}
@@ -102,3 +102,47 @@ TEST(CbAdf, NoWarningForHigherLevelReductions)
   EXPECT_FALSE(capture.has_warning_containing("cb_adf is used with JSON input but without any interaction features"));
   vw->finish();
 }
+
+namespace
+{
+std::vector<float> learn_cb_adf_scores(std::vector<std::string> args)
+{
+  args.emplace_back("--quiet");
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  std::vector<float> scores;
+  for (int i = 0; i < 40; ++i)
+  {
+    // The shared example and the actions both use namespace a, so the shared features land between action features.
+    VW::multi_ex ex = {VW::read_example(*vw, "shared |s s_" + std::to_string(i % 3) + " t:0.5 |a shared_a"),
+        VW::read_example(*vw, "|a a1 |b b" + std::to_string(i % 5)),
+        VW::read_example(*vw, "0:" + std::to_string(i % 2) + ":0.5 |a a2 |b b1 b2:2"),
+        VW::read_example(*vw, "|b b" + std::to_string(i % 4))};
+    vw->learn(ex);
+    for (const auto& action_score : ex[0]->pred.a_s) { scores.push_back(action_score.score); }
+    ex[1]->l.cb.costs.clear();
+    ex[2]->l.cb.costs.clear();
+    vw->predict(ex);
+    for (const auto& action_score : ex[0]->pred.a_s) { scores.push_back(action_score.score); }
+    vw->finish_example(ex);
+  }
+  return scores;
+}
+}  // namespace
+
+TEST(CbAdf, CacheSharedScoreMatchesMergedScores)
+{
+  const std::vector<std::vector<std::string>> configs = {{"--cb_adf"}, {"--cb_adf", "-q", "sb", "--cb_type", "dr"},
+      {"--cb_explore_adf", "--epsilon", "0.1", "-q", "::"}, {"--cb_explore_adf", "--bag", "3"},
+      {"--cb_adf", "--sparse_weights", "--ignore_linear", "s"}};
+  for (const auto& config : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(config));
+    auto cached_args = config;
+    cached_args.emplace_back("--cache_shared_score");
+    const auto merged = learn_cb_adf_scores(config);
+    const auto cached = learn_cb_adf_scores(cached_args);
+    ASSERT_EQ(merged.size(), cached.size());
+    // Only the order of the summation differs.
+    for (size_t i = 0; i < merged.size(); ++i) { EXPECT_NEAR(merged[i], cached[i], 1e-4f) << "score " << i; }
+  }
+}
@@ -17,6 +17,7 @@
 #include <cstdio>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ============================================================
 // LDA (--lda N) Tests
@@ -458,6 +459,33 @@ TEST(CoverageNumericReductions, KsvmPolyMultipleExamples)
   }
 }
 
+TEST(CoverageNumericReductions, KsvmKernelRowsDoNotDependOnThreadsOrWeights)
+{
+  auto train = [](std::vector<std::string> args)
+  {
+    args.insert(args.end(), {"--ksvm", "--kernel", "rbf", "--bandwidth", "0.5", "--reprocess", "2", "--quiet"});
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    std::vector<float> predictions;
+    // Noisy labels keep a few hundred support vectors, enough to split the kernel rows over the threads.
+    for (int i = 0; i < 600; i++)
+    {
+      std::string label = ((i * 7919) % 13 < 6) ? "1" : "-1";
+      auto* ex = VW::read_example(*vw,
+          label + " |f a" + std::to_string(i % 37) + ":0.5 b" + std::to_string(i % 11) +
+              " c:" + std::to_string((i % 17) * 0.1f));
+      vw->learn(*ex);
+      predictions.push_back(ex->pred.scalar);
+      vw->finish_example(*ex);
+    }
+    return predictions;
+  };
+
+  // Sparse weights merge the sorted features instead of scattering the example.
+  const auto merged = train({"--sparse_weights"});
+  EXPECT_EQ(train({}), merged);
+  EXPECT_EQ(train({"--ksvm_threads", "4"}), merged);
+}
+
 TEST(CoverageNumericReductions, KsvmPoolGreedyWithPoolSize)
 {
   auto vw = VW::initialize(vwtest::make_args("--ksvm", "--pool_greedy", "--pool_size", "5", "--quiet"));
@@ -19,7 +19,9 @@
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <limits>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -1060,6 +1062,89 @@ TEST(CoverageTextParser, ParseFloatLongDecimal)
   EXPECT_NEAR(result, 1.1234567f, 0.001f);
 }
 
+TEST(CoverageTextParser, ParseFloatMatchesStrtof)
+{
+  std::vector<std::string> values = {"0.1", "0.3", "4.36352", "16777216", "16777217", "0.123456789", "1e10", "1e-10",
+      "3.4e38", "1.17549435e-38", "123456.789e-3", "0.0000001", "9999999.5", "2.5e-7", "100000000000000000000"};
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<uint32_t> digits(0, 99999999);
+  std::uniform_int_distribution<int> exponent(-14, 14);
+  for (size_t i = 0; i < 2000; i++)
+  {
+    values.push_back(std::to_string(digits(rng)) + "e" + std::to_string(exponent(rng)));
+  }
+
+  for (const auto& value : values)
+  {
+    size_t end_idx = 0;
+    const float result = VW::details::parse_float(value.c_str(), end_idx);
+    EXPECT_EQ(result, std::strtof(value.c_str(), nullptr)) << value;
+    EXPECT_EQ(end_idx, value.size()) << value;
+  }
+}
+
+TEST(CoverageTextParser, ParseFloatMatchesStrtofForLongSignificands)
+{
+  // Significands above 2^24 and exponents outside of the fast path, down to subnormals and up to overflow.
+  std::vector<std::string> values = {"1e-45", "7.006492321624086e-46", "1.1754942e-38", "3.4028235e38",
+      "3.4028236e38", "1e39", "1e-66", "9999999999999999999e-65", "16777217.5", "-0.30000001192092896",
+      "123456789012345678", "33554433", "0.1234567890123456789"};
+  std::mt19937_64 rng(11);
+  std::uniform_int_distribution<int> num_digits(1, 19);
+  std::uniform_int_distribution<int> digit(0, 9);
+  std::uniform_int_distribution<int> exponent(-70, 45);
+  for (size_t i = 0; i < 20000; i++)
+  {
+    std::string value = i % 2 == 0 ? "" : "-";
+    const int digits = num_digits(rng);
+    for (int d = 0; d < digits; d++) { value += static_cast<char>('0' + digit(rng)); }
+    values.push_back(value + "e" + std::to_string(exponent(rng)));
+  }
+
+  for (const auto& value : values)
+  {
+    size_t end_idx = 0;
+    const float result = VW::details::parse_float(value.c_str(), end_idx);
+    const float expected = std::strtof(value.c_str(), nullptr);
+    EXPECT_EQ(std::memcmp(&result, &expected, sizeof(float)), 0) << value << " " << result << " " << expected;
+    EXPECT_EQ(end_idx, value.size()) << value;
+  }
+}
+
+TEST(CoverageTextParser, ParseFloatWithEndLineDoesNotReadPastIt)
+{
+  // The value needs more digits than the fast path handles, and the characters after end_line are digits too.
+  const char* str = "0.1234567891239999";
+  size_t end_idx = 0;
+  const float result = VW::details::parse_float(str, end_idx, str + 14);
+  EXPECT_EQ(result, std::strtof("0.123456789123", nullptr));
+  EXPECT_EQ(end_idx, 14u);
+}
+
+TEST(CoverageTextParser, TextParserNamesOfAnyLength)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--no_stdin"));
+  const uint64_t ns_hash = VW::hash_space(*vw, "ns");
+  const uint64_t multiplier = static_cast<uint64_t>(vw->reduction_state.total_feature_width)
+      << vw->weights.stride_shift();
+  // Lengths on both sides of the vector widths used to search for the end of a name.
+  for (size_t length = 1; length < 80; length++)
+  {
+    std::string name;
+    for (size_t i = 0; i < length; i++) { name += static_cast<char>('a' + (i * 7 + length) % 26); }
+    for (const std::string& suffix : {std::string(":2"), std::string(" "), std::string("|x y"), std::string("")})
+    {
+      auto* ex = VW::read_example(*vw, "1 |ns " + name + suffix);
+      const auto& fs = ex->feature_space['n'];
+      ASSERT_GE(fs.size(), 1u) << name << suffix;
+      EXPECT_EQ(fs.indices[0], (VW::hash_feature(*vw, name, ns_hash) & vw->runtime_state.parse_mask) * multiplier)
+          << name << suffix;
+      EXPECT_FLOAT_EQ(fs.values[0], suffix == ":2" ? 2.f : 1.f) << name << suffix;
+      VW::finish_example(*vw, *ex);
+    }
+  }
+}
+
 TEST(CoverageTextParser, EscapedTokenizeBasic)
 {
   auto result = VW::details::escaped_tokenize(',', "a,b,c");
@@ -131,6 +131,56 @@ TEST(EigenMemoryTree, ExactMatchWithRouterTest)
   }
 }
 
+TEST(EigenMemoryTree, ThreadsPredictLikeOneThread)
+{
+  std::vector<uint32_t> predictions[2];
+  for (int run = 0; run < 2; run++)
+  {
+    auto vw = VW::initialize(
+        vwtest::make_args("--quiet", "--emt", "--emt_leaf", "200", "--emt_threads", run == 0 ? "1" : "4"));
+
+    for (int i = 0; i < 150; i++)
+    {
+      auto* ex = VW::read_example(
+          *vw, std::to_string(i % 10) + " | a:" + std::to_string(i % 7) + " b:" + std::to_string(i % 11 + 0.5));
+      vw->learn(*ex);
+      vw->finish_example(*ex);
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+      auto* ex = VW::read_example(*vw, " | a:" + std::to_string(i % 7 + 0.2) + " b:" + std::to_string(i % 11));
+      vw->predict(*ex);
+      predictions[run].push_back(ex->pred.multiclass);
+      vw->finish_example(*ex);
+    }
+  }
+
+  EXPECT_EQ(predictions[0], predictions[1]);
+}
+
+TEST(EigenMemoryTree, ExactMatchWithPrefilterTest)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_leaf", "50", "--emt_prefilter", "4"));
+  auto* tree = get_emt_tree(*vw);
+  EXPECT_EQ(tree->prefilter, 4);
+
+  for (int i = 0; i < 10; i++)
+  {
+    auto* ex = VW::read_example(*vw, std::to_string(i) + " | " + std::to_string(i));
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  for (int i = 0; i < 10; i++)
+  {
+    auto* ex = VW::read_example(*vw, " | " + std::to_string(i));
+    vw->predict(*ex);
+    EXPECT_EQ(ex->pred.multiclass, i);
+    vw->finish_example(*ex);
+  }
+}
+
 TEST(EigenMemoryTree, BoundingDrop)
 {
   auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_tree", "5"));
@@ -233,6 +283,20 @@ TEST(EigenMemoryTree, Inner)
   EXPECT_EQ(emt_inner(v1, v2), 16);
 }
 
+TEST(EigenMemoryTree, Sketch)
+{
+  emt_feats v1;
+  emt_feats v2;
+
+  v1.emplace_back(1, 2.f);
+  v1.emplace_back(7, -1.f);
+  v2.emplace_back(1, -2.f);
+  v2.emplace_back(7, 1.f);
+
+  EXPECT_EQ(emt_sketch(v1), emt_sketch(v1));
+  EXPECT_EQ(emt_sketch(v1), ~emt_sketch(v2));
+}
+
 TEST(EigenMemoryTree, ScaleAdd)
 {
   emt_feats v1;
@@ -0,0 +1,172 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/event_daemon.h"
+
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+#  include <string>
+#  include <thread>
+#  include <vector>
+
+namespace
+{
+int listen_on_loopback(uint16_t& port)
+{
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  EXPECT_EQ(::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+  EXPECT_EQ(::listen(fd, 1), 0);
+  socklen_t size = sizeof(address);
+  ::getsockname(fd, reinterpret_cast<sockaddr*>(&address), &size);
+  port = ntohs(address.sin_port);
+  return fd;
+}
+
+int connect_to(uint16_t port)
+{
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  EXPECT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+  return fd;
+}
+
+void send_all(int fd, const std::string& data)
+{
+  size_t sent = 0;
+  while (sent < data.size())
+  {
+    const auto n = ::send(fd, data.data() + sent, data.size() - sent, 0);
+    ASSERT_GT(n, 0);
+    sent += static_cast<size_t>(n);
+  }
+}
+
+// Reads until the daemon closes the connection and returns the received lines.
+std::vector<std::string> read_lines(int fd)
+{
+  std::string received;
+  char buffer[1024];
+  ssize_t n = 0;
+  while ((n = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) { received.append(buffer, static_cast<size_t>(n)); }
+
+  std::vector<std::string> lines;
+  size_t start = 0;
+  size_t end = 0;
+  while ((end = received.find('\n', start)) != std::string::npos)
+  {
+    lines.push_back(received.substr(start, end - start));
+    start = end + 1;
+  }
+  return lines;
+}
+}  // namespace
+
+TEST(EventDaemon, PredictionsGoBackToTheirConnection)
+{
+  // Test only with fixed weights, so each prediction depends only on its own line.
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "-t", "--initial_weight", "0.5", "--noconstant",
+      "--min_prediction", "-10", "--max_prediction", "10"));
+  uint16_t port = 0;
+  const int listen_fd = listen_on_loopback(port);
+  VW::details::event_daemon daemon(*vw, listen_fd, 2);
+  std::thread server([&daemon] { daemon.run(); });
+
+  const std::vector<std::string> examples = {"|a x", "|a x y", "|a x y z"};
+  std::vector<int> clients;
+  for (size_t i = 0; i < examples.size(); ++i) { clients.push_back(connect_to(port)); }
+  // Interleave the lines of all clients, the last one without a trailing newline.
+  for (size_t repeat = 0; repeat < 3; ++repeat)
+  {
+    for (size_t i = 0; i < clients.size(); ++i) { send_all(clients[i], examples[i] + (repeat < 2 ? "\n" : "")); }
+  }
+
+  for (size_t i = 0; i < clients.size(); ++i)
+  {
+    ::shutdown(clients[i], SHUT_WR);
+    const auto lines = read_lines(clients[i]);
+    ASSERT_EQ(lines.size(), 3);
+    for (const auto& line : lines) { EXPECT_FLOAT_EQ(std::stof(line), 0.5f * static_cast<float>(i + 1)); }
+    ::close(clients[i]);
+  }
+
+  daemon.stop();
+  server.join();
+  EXPECT_EQ(daemon.num_connections(), 0);
+  ::close(listen_fd);
+}
+
+TEST(EventDaemon, ServesMoreConnectionsThanChildren)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet"));
+  uint16_t port = 0;
+  const int listen_fd = listen_on_loopback(port);
+  VW::details::event_daemon daemon(*vw, listen_fd, 16);
+  std::thread server([&daemon] { daemon.run(); });
+
+  // All connections are open at once, which forked children could only serve num_children at a time.
+  std::vector<int> clients;
+  for (size_t i = 0; i < 64; ++i) { clients.push_back(connect_to(port)); }
+  for (auto fd : clients)
+  {
+    send_all(fd, "1 |a x\n0 |b y\n");
+    ::shutdown(fd, SHUT_WR);
+  }
+  for (auto fd : clients)
+  {
+    EXPECT_EQ(read_lines(fd).size(), 2);
+    ::close(fd);
+  }
+
+  daemon.stop();
+  server.join();
+  EXPECT_EQ(vw->sd->example_number, 128);
+  ::close(listen_fd);
+}
+
+TEST(EventDaemon, BadLineOnlyClosesItsConnection)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--strict_parse"));
+  uint16_t port = 0;
+  const int listen_fd = listen_on_loopback(port);
+  VW::details::event_daemon daemon(*vw, listen_fd, 4);
+  std::thread server([&daemon] { daemon.run(); });
+
+  const int bad_client = connect_to(port);
+  const int good_client = connect_to(port);
+  send_all(bad_client, "1 |a x\n1 |a x:nan\n1 |a x\n");
+  send_all(good_client, "1 |a x\n0 |b y\n");
+  ::shutdown(good_client, SHUT_WR);
+
+  // The bad client is disconnected without waiting for it to finish sending.
+  EXPECT_LE(read_lines(bad_client).size(), 1);
+  EXPECT_EQ(read_lines(good_client).size(), 2);
+  ::close(bad_client);
+  ::close(good_client);
+
+  daemon.stop();
+  server.join();
+  EXPECT_EQ(daemon.num_connections(), 0);
+  ::close(listen_fd);
+}
+
+#endif
@@ -4,9 +4,14 @@
 
 #include "vw/core/example.h"
 
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
+
 TEST(Example, MoveCtorMovesPred)
 {
   VW::example ex;
@@ -32,3 +37,37 @@ TEST(Example, MoveAssignOpMovesPred)
   EXPECT_EQ(ex.pred.a_s.size(), 0);
   EXPECT_EQ(ex2.pred.a_s.size(), 1);
 }
+
+TEST(Example, PooledExampleKeepsFeatureBuffers)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet"));
+  std::string line = "1 |a";
+  for (size_t i = 0; i < 100; i++) { line += " f" + std::to_string(i); }
+
+  auto* first = VW::read_example(*vw, line);
+  const auto* values = first->feature_space['a'].values.data();
+  const auto* indices = first->feature_space['a'].indices.data();
+  vw->finish_example(*first);
+
+  // The slot is handed out again and its buffers are refilled in place.
+  auto* second = VW::read_example(*vw, "1 |a x y z");
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(second->feature_space['a'].size(), 3);
+  EXPECT_EQ(second->feature_space['a'].values.data(), values);
+  EXPECT_EQ(second->feature_space['a'].indices.data(), indices);
+  vw->finish_example(*second);
+}
+
+TEST(Example, EmptyExampleReleasesOutlierFeatureBuffers)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet"));
+  auto* ex = VW::read_example(*vw, "1 |a x");
+  auto& fs = ex->feature_space['a'];
+  for (size_t i = 0; i <= VW::details::MAX_RETAINED_FEATURES; i++) { fs.push_back(1.f, i); }
+
+  VW::empty_example(*vw, *ex);
+  EXPECT_TRUE(fs.empty());
+  EXPECT_LT(fs.values.capacity(), VW::details::MAX_RETAINED_FEATURES);
+  EXPECT_LT(fs.indices.capacity(), VW::details::MAX_RETAINED_FEATURES);
+  vw->finish_example(*ex);
+}
@@ -156,3 +156,25 @@ TEST(FeatureGroup, IterateExtentsTest)
     EXPECT_EQ(std::distance((*begin).first, (*begin).second), 5);
   }
 }
+
+TEST(FeatureGroup, AppendMatchesPushBack)
+{
+  const std::vector<VW::feature_value> values = {1.f, -2.f, 0.5f};
+  const std::vector<VW::feature_index> indices = {4, 8, 15};
+
+  VW::features pushed;
+  VW::features appended;
+  pushed.push_back(3.f, 1);
+  appended.push_back(3.f, 1);
+  pushed.start_ns_extent(7);
+  appended.start_ns_extent(7);
+  for (size_t i = 0; i < values.size(); ++i) { pushed.push_back(values[i], indices[i]); }
+  appended.append(values.data(), indices.data(), values.size());
+  pushed.end_ns_extent();
+  appended.end_ns_extent();
+
+  EXPECT_THAT(appended.values, ElementsAreArray(pushed.values));
+  EXPECT_THAT(appended.indices, ElementsAreArray(pushed.indices));
+  EXPECT_FLOAT_EQ(appended.sum_feat_sq, pushed.sum_feat_sq);
+  EXPECT_THAT(appended.namespace_extents, ContainerEq(pushed.namespace_extents));
+}
@@ -0,0 +1,142 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/learner.h"
+#include "vw/core/simple_label.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Wide examples so that every namespace has full SIMD chunks, a tail and the occasional repeated feature.
+std::vector<std::string> make_wide_examples(size_t count)
+{
+  std::vector<std::string> examples;
+  for (size_t i = 0; i < count; ++i)
+  {
+    std::ostringstream ss;
+    ss << ((i % 3 == 0) ? "1" : "-1") << " |a";
+    // No value lands next to 0: a weight that only ever sees a ~1e-9 feature gets a huge adaptive learning rate,
+    // which would amplify the reordered sums of the SIMD path.
+    for (size_t f = 0; f < 37; ++f)
+    {
+      ss << " a" << ((i * 7 + f * 13) % 50) << ":" << (0.01f * ((i + f) % 17) - 0.055f);
+    }
+    ss << " |b";
+    for (size_t f = 0; f < 19; ++f) { ss << " b" << ((i + f) % 23) << ":" << (f % 5 + 1); }
+    ss << " |c c" << (i % 4);
+    examples.push_back(ss.str());
+  }
+  return examples;
+}
+
+std::vector<float> learn_and_collect_predictions(std::vector<std::string> args, const std::vector<std::string>& data)
+{
+  args.emplace_back("--quiet");
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  std::vector<float> predictions;
+  for (const auto& line : data)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    predictions.push_back(ex->pred.scalar);
+    vw->finish_example(*ex);
+  }
+  return predictions;
+}
+}  // namespace
+
+TEST(Gd, ExplicitSimdMatchesScalarPath)
+{
+  const auto data = make_wide_examples(200);
+  const std::vector<std::vector<std::string>> configs = {
+      {}, {"--adaptive"}, {"--normalized"}, {"--sgd"}, {"--invariant"}, {"-q", "ab"}, {"--ignore_linear", "b"}};
+
+  for (const auto& config : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(config));
+    auto simd_args = config;
+    simd_args.emplace_back("--gd_explicit_simd");
+    const auto scalar = learn_and_collect_predictions(config, data);
+    const auto simd = learn_and_collect_predictions(simd_args, data);
+    ASSERT_EQ(scalar.size(), simd.size());
+    for (size_t i = 0; i < scalar.size(); ++i)
+    {
+      // Only the order of the summations differs.
+      EXPECT_NEAR(scalar[i], simd[i], 1e-4f * std::max(1.f, std::fabs(scalar[i]))) << "example " << i;
+    }
+  }
+}
+
+TEST(Gd, ExplicitSimdFallsBackToScalarWithSparseWeights)
+{
+  const auto data = make_wide_examples(50);
+  const auto scalar = learn_and_collect_predictions({"--sparse_weights"}, data);
+  const auto simd = learn_and_collect_predictions({"--sparse_weights", "--gd_explicit_simd"}, data);
+  EXPECT_EQ(scalar, simd);
+}
+
+TEST(Gd, MultiupdateMatchesSequentialUpdates)
+{
+  constexpr size_t num_classes = 7;
+  const auto data = make_wide_examples(100);
+  const std::vector<std::vector<std::string>> configs = {{}, {"--adaptive"}, {"--normalized"}, {"--sgd"},
+      {"--power_t", "0.3"}, {"--loss_function", "logistic"}, {"--sparse_weights"}, {"--sparse_l2", "1e-4"},
+      {"-q", "ab"}, {"--l2", "1e-5"}};
+
+  for (const auto& config : configs)
+  {
+    SCOPED_TRACE(::testing::PrintToString(config));
+    std::vector<std::unique_ptr<VW::workspace>> workspaces;
+    for (bool fused : {true, false})
+    {
+      auto args = config;
+      args.insert(args.end(), {"--oaa", std::to_string(num_classes), "--quiet"});
+      auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+      auto* scorer = vw->l->get_learner_by_name_prefix("scorer");
+      std::vector<VW::polyprediction> pred(num_classes);
+      std::vector<float> labels(num_classes);
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        // Drive the scorer the way oaa does, with each class updated on its own in the reference workspace.
+        auto* ex = VW::read_example(*vw, std::to_string(1 + i % num_classes) + data[i].substr(data[i].find(' ')));
+        const auto multi = ex->l.multi;
+        ex->l.simple = {FLT_MAX};
+        ex->ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+        scorer->multipredict(*ex, 0, num_classes, pred.data(), true);
+        for (size_t c = 0; c < num_classes; ++c) { labels[c] = (multi.label == c + 1) ? 1.f : -1.f; }
+        if (fused) { scorer->multiupdate(*ex, 0, num_classes, labels.data(), pred.data()); }
+        else
+        {
+          for (size_t c = 0; c < num_classes; ++c)
+          {
+            ex->l.simple.label = labels[c];
+            ex->pred.scalar = pred[c].scalar;
+            scorer->update(*ex, c);
+          }
+        }
+        ex->l.multi = multi;
+        vw->finish_example(*ex);
+      }
+      workspaces.push_back(std::move(vw));
+    }
+
+    auto& fused = *workspaces[0];
+    auto& sequential = *workspaces[1];
+    for (uint64_t i = 0; i < (fused.length() << fused.weights.stride_shift()); i++)
+    {
+      ASSERT_EQ(fused.weights[i], sequential.weights[i]) << "weight " << i;
+    }
+  }
+}
@@ -535,4 +535,123 @@ TEST(Interactions, ExtentVsCharInteractionsCubicWildcardPermutationsConstant)
 TEST(Interactions, ExtentVsCharInteractionsCubicWildcardPermutationsCombinationsConstant)
 {
   do_interaction_feature_count_test(true, true, true, false);
-}
\ No newline at end of file
+}
+namespace
+{
+std::vector<float> learn_with_interactions(std::vector<std::string> args)
+{
+  const std::vector<std::string> data = {"1 |a x y z |b u:0.5 v w |c k l", "2 |a x z |b v:2 w |c l m n",
+      "3 |a y |b u v |c k", "1 |a x y z w |b u |c m n:0.25", "2 |a z |b v w u |c k l m n"};
+  args.emplace_back("--quiet");
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  std::vector<float> predictions;
+  for (size_t pass = 0; pass < 3; ++pass)
+  {
+    for (const auto& line : data)
+    {
+      auto* ex = VW::read_example(*vw, line);
+      vw->learn(*ex);
+      predictions.push_back(static_cast<float>(ex->pred.multiclass));
+      predictions.push_back(ex->partial_prediction);
+      vw->finish_example(*ex);
+    }
+  }
+  return predictions;
+}
+}  // namespace
+
+TEST(Interactions, InteractionExpansionCacheGivesIdenticalResults)
+{
+  const std::vector<std::string> base_args = {"--oaa", "3", "-q", "ab", "--cubic", "abc", "--interactions", "aabc"};
+  auto cached_args = base_args;
+  cached_args.insert(cached_args.end(), {"--interaction_expansion_cache", "2"});
+  EXPECT_EQ(learn_with_interactions(base_args), learn_with_interactions(cached_args));
+}
+
+TEST(Interactions, InteractionExpansionCacheWithAutomlGivesIdenticalResults)
+{
+  auto run = [](bool cached)
+  {
+    std::vector<std::string> args = {"--automl", "3", "--cb_explore_adf", "--oracle_type", "one_diff",
+        "--default_lease", "5", "--quiet"};
+    if (cached) { args.insert(args.end(), {"--interaction_expansion_cache", "4"}); }
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    std::vector<float> probabilities;
+    for (int i = 0; i < 50; ++i)
+    {
+      VW::multi_ex ex = {VW::read_example(*vw, "shared |s s_" + std::to_string(i % 3)),
+          VW::read_example(*vw, "0:-" + std::to_string(i % 2) + ":0.5 |a a1 |b b1"),
+          VW::read_example(*vw, "|a a2 |b b2 |c c" + std::to_string(i % 4))};
+      vw->learn(ex);
+      for (const auto& action_score : ex[0]->pred.a_s) { probabilities.push_back(action_score.score); }
+      vw->finish_example(ex);
+    }
+    return probabilities;
+  };
+  EXPECT_EQ(run(false), run(true));
+}
+
+TEST(Interactions, InteractionExpansionCacheWithCcbSlotValuesGivesIdenticalResults)
+{
+  auto run = [](bool cached)
+  {
+    // Without the slot index the slots of an example only differ in the value of their feature, so the actions keep
+    // the same namespace sizes from one slot to the next.
+    std::vector<std::string> args = {"--ccb_explore_adf", "--ccb_no_slot_index", "-q", "sa", "--quiet"};
+    if (cached) { args.insert(args.end(), {"--interaction_expansion_cache", "2"}); }
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    for (int i = 0; i < 20; ++i)
+    {
+      VW::multi_ex ex = {VW::read_example(*vw, "ccb shared |u user"), VW::read_example(*vw, "ccb action |a a1"),
+          VW::read_example(*vw, "ccb action |a a2"), VW::read_example(*vw, "ccb action |a a3"),
+          VW::read_example(*vw, "ccb slot " + std::to_string(i % 3) + ":-1:0.5 |s f:1"),
+          VW::read_example(*vw, "ccb slot " + std::to_string((i + 1) % 3) + ":-0.5:0.5 |s f:2")};
+      vw->learn(ex);
+      vw->finish_example(ex);
+    }
+    const auto& weights = vw->weights.dense_weights;
+    return std::vector<float>(weights.data(), weights.data() + weights.raw_length());
+  };
+  EXPECT_EQ(run(false), run(true));
+}
+
+TEST(Interactions, InteractionExpansionCacheReusesAndInvalidates)
+{
+  auto vw = VW::initialize(vwtest::make_args("-q", "ab", "--interaction_expansion_cache", "2", "--quiet"));
+  auto* ex = VW::read_example(*vw, "1 |a x y |b u v w");
+
+  size_t count = 0;
+  float value = 0.f;
+  eval_gen_data dat(count, value);
+  size_t num_features = 0;
+  VW::generate_interactions<eval_gen_data, uint64_t, ft_cnt, false, nullptr>(*vw, *ex, dat, num_features);
+  EXPECT_EQ(num_features, 6);
+  ASSERT_EQ(ex->interaction_expansions.entries.size(), 1);
+  const auto* cached_indices = ex->interaction_expansions.entries[0].indices.data();
+
+  // Same interactions at another offset reuse the expansion.
+  ex->ft_offset += vw->weights.stride();
+  VW::generate_interactions<eval_gen_data, uint64_t, ft_cnt, false, nullptr>(*vw, *ex, dat, num_features);
+  EXPECT_EQ(num_features, 6);
+  EXPECT_EQ(count, 12);
+  ASSERT_EQ(ex->interaction_expansions.entries.size(), 1);
+  EXPECT_EQ(ex->interaction_expansions.entries[0].indices.data(), cached_indices);
+
+  // A different interaction set gets its own entry.
+  std::vector<std::vector<VW::namespace_index>> other_interactions = {{'a', 'a'}};
+  auto* saved_interactions = ex->interactions;
+  ex->interactions = &other_interactions;
+  VW::generate_interactions<eval_gen_data, uint64_t, ft_cnt, false, nullptr>(*vw, *ex, dat, num_features);
+  EXPECT_EQ(num_features, 3);
+  EXPECT_EQ(ex->interaction_expansions.entries.size(), 2);
+  ex->interactions = saved_interactions;
+
+  // Adding features is noticed without an explicit invalidate.
+  ex->feature_space['b'].push_back(1.f, 12345);
+  VW::generate_interactions<eval_gen_data, uint64_t, ft_cnt, false, nullptr>(*vw, *ex, dat, num_features);
+  EXPECT_EQ(num_features, 8);
+
+  VW::empty_example(*vw, *ex);
+  for (const auto& entry : ex->interaction_expansions.entries) { EXPECT_FALSE(entry.valid); }
+  vw->finish_example(*ex);
+}
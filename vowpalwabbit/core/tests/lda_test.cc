@@ -0,0 +1,71 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/memory.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::unique_ptr<VW::workspace> train_lda(std::vector<std::string> args)
+{
+  args.insert(args.end(), {"--quiet", "--lda_D", "1000", "--minibatch", "8", "-b", "10"});
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  for (size_t i = 0; i < 64; i++)
+  {
+    std::string doc = "|";
+    for (size_t j = 0; j < 6; j++)
+    {
+      doc += " w" + std::to_string((i * 7 + j * (i % 5 + 1)) % 40) + ":" + std::to_string(1 + j % 3);
+    }
+    auto* ex = VW::read_example(*vw, doc);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  return vw;
+}
+}  // namespace
+
+TEST(Lda, ThreadsMatchSingleThreadedEStep)
+{
+  auto serial = train_lda({"--lda", "5"});
+  auto threaded = train_lda({"--lda", "5", "--lda_threads", "3"});
+
+  // The E-steps of the documents are independent and merged in document order, so the results are identical.
+  EXPECT_EQ(threaded->sd->sum_loss, serial->sd->sum_loss);
+  for (uint64_t i = 0; i < serial->length(); i++)
+  {
+    for (uint32_t k = 0; k < 5; k++)
+    {
+      EXPECT_EQ((&threaded->weights.strided_index(i))[k], (&serial->weights.strided_index(i))[k]) << "index " << i;
+    }
+  }
+}
+
+TEST(Lda, ExplicitSimdMatchesSseKernels)
+{
+  // 21 topics leave a partial vector for both the AVX2 and the AVX-512 kernels.
+  auto sse = train_lda({"--lda", "21"});
+  auto simd = train_lda({"--lda", "21", "--lda_explicit_simd"});
+
+  EXPECT_NEAR(simd->sd->sum_loss, sse->sd->sum_loss, 1e-3 * std::abs(sse->sd->sum_loss));
+  for (uint64_t i = 0; i < sse->length(); i++)
+  {
+    for (uint32_t k = 0; k < 21; k++)
+    {
+      const float expected = (&sse->weights.strided_index(i))[k];
+      EXPECT_NEAR((&simd->weights.strided_index(i))[k], expected, 1e-3f * std::max(1.f, std::abs(expected)))
+          << "index " << i;
+    }
+  }
+}
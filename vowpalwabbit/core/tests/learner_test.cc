@@ -4,13 +4,19 @@
 
 #include "vw/core/learner.h"
 
+#include "vw/config/options_cli.h"
 #include "vw/core/global_data.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -264,6 +270,219 @@ TEST(Learner, FeatureWidthBelowForReductionStack)
   EXPECT_GE(vw->l->feature_width_below, 1);
 }
 
+namespace
+{
+std::string write_learner_threads_data_file(const std::string& name, size_t num_lines)
+{
+  const auto file_name = ::testing::TempDir() + name;
+  std::ofstream data(file_name);
+  for (size_t i = 0; i < num_lines; ++i)
+  {
+    // The label only depends on feature a so there is a clear signal to learn.
+    const bool positive = i % 2 == 0;
+    data << (positive ? "1" : "-1") << " |f a" << (positive ? 1 : 2) << " b" << i % 13 << " c" << i % 29 << '\n';
+  }
+  return file_name;
+}
+
+std::unique_ptr<VW::workspace> train_with_driver(const std::vector<std::string>& args)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+  return vw;
+}
+
+float predict_text(VW::workspace& vw, const std::string& line)
+{
+  auto* ex = VW::read_example(vw, line);
+  vw.predict(*ex);
+  const float prediction = ex->pred.scalar;
+  vw.finish_example(*ex);
+  return prediction;
+}
+}  // namespace
+
+TEST(Learner, LearnerThreadsHogwildLearnsEveryExample)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads.txt", 4000);
+  auto serial = train_with_driver({"--quiet", "-d", data_file, "--binary"});
+  auto hogwild = train_with_driver({"--quiet", "-d", data_file, "--binary", "--learner_threads", "4"});
+
+  EXPECT_EQ(hogwild->sd->example_number, serial->sd->example_number);
+  EXPECT_EQ(hogwild->sd->total_features, serial->sd->total_features);
+  EXPECT_DOUBLE_EQ(hogwild->sd->weighted_labels, serial->sd->weighted_labels);
+  // Updates race with each other so only the quality of the model can be compared.
+  EXPECT_LT(hogwild->sd->sum_loss / hogwild->sd->weighted_labeled_examples, 0.05);
+  EXPECT_EQ(predict_text(*hogwild, "|f a1 b3 c7"), 1.f);
+  EXPECT_EQ(predict_text(*hogwild, "|f a2 b3 c7"), -1.f);
+
+  serial->finish();
+  hogwild->finish();
+  std::remove(data_file.c_str());
+}
+
+TEST(Learner, LearnerThreadsHogwildSharesSparseWeights)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads_sparse.txt", 4000);
+  auto serial = train_with_driver({"--quiet", "-d", data_file, "--binary", "--sparse_weights"});
+  auto hogwild =
+      train_with_driver({"--quiet", "-d", data_file, "--binary", "--sparse_weights", "--learner_threads", "4"});
+
+  EXPECT_EQ(hogwild->sd->example_number, serial->sd->example_number);
+  EXPECT_TRUE(hogwild->weights.sparse_weights.concurrent_inserts());
+  // Every feature is stored once, no matter which threads inserted it.
+  EXPECT_EQ(hogwild->weights.sparse_weights.size(), serial->weights.sparse_weights.size());
+  EXPECT_LT(hogwild->sd->sum_loss / hogwild->sd->weighted_labeled_examples, 0.05);
+  EXPECT_EQ(predict_text(*hogwild, "|f a1 b3 c7"), 1.f);
+  EXPECT_EQ(predict_text(*hogwild, "|f a2 b3 c7"), -1.f);
+
+  serial->finish();
+  hogwild->finish();
+  std::remove(data_file.c_str());
+}
+
+TEST(Learner, LearnerThreadsSumsGdStateOfAllThreads)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads_gd_state.txt", 2000);
+  auto serial = train_with_driver({"--quiet", "-d", data_file});
+  auto hogwild = train_with_driver({"--quiet", "-d", data_file, "--learner_threads", "4"});
+
+  const auto gd_state = [](VW::workspace& all)
+  {
+    auto* gd = all.l->get_learner_by_name_prefix("gd")->get_internal_type_erased_data_pointer_test_use_only();
+    return static_cast<VW::reductions::gd*>(gd)->gd_per_model_states[0];
+  };
+  // Every example adds its weight, no matter which thread learned it. The norms depend on the order of the updates.
+  EXPECT_DOUBLE_EQ(gd_state(*hogwild).total_weight, gd_state(*serial).total_weight);
+  EXPECT_GT(gd_state(*hogwild).normalized_sum_norm_x, 0.5 * gd_state(*serial).normalized_sum_norm_x);
+
+  serial->finish();
+  hogwild->finish();
+  std::remove(data_file.c_str());
+}
+
+TEST(Learner, LearnerThreadsCombinesObservedLabelsOfAllThreads)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads_labels.txt", 2000);
+  auto hogwild = train_with_driver({"--quiet", "-d", data_file, "--learner_threads", "4"});
+
+  // Each thread records the labels it learns in its own shared data, which are merged into the master's.
+  EXPECT_FLOAT_EQ(hogwild->sd->min_label, -1.f);
+  EXPECT_FLOAT_EQ(hogwild->sd->max_label, 1.f);
+  EXPECT_FALSE(hogwild->sd->is_more_than_two_labels_observed);
+  EXPECT_FLOAT_EQ(std::min(hogwild->sd->first_observed_label, hogwild->sd->second_observed_label), -1.f);
+  EXPECT_FLOAT_EQ(std::max(hogwild->sd->first_observed_label, hogwild->sd->second_observed_label), 1.f);
+
+  hogwild->finish();
+  std::remove(data_file.c_str());
+}
+
+TEST(Learner, LearnerThreadsSupportsMultiplePasses)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads_passes.txt", 1000);
+  const auto cache_file = data_file + ".cache";
+  auto vw = train_with_driver({"--quiet", "-d", data_file, "--cache_file", cache_file, "--passes", "3",
+      "--holdout_off", "--learner_threads", "3"});
+
+  EXPECT_EQ(vw->sd->example_number, 3000);
+  EXPECT_EQ(vw->passes_config.current_pass, 3);
+  vw->finish();
+  std::remove(data_file.c_str());
+  std::remove(cache_file.c_str());
+}
+
+TEST(Learner, LearnerThreadsFallsBackToSingleThreadForUnsupportedStack)
+{
+  const auto data_file = write_learner_threads_data_file("vw_learner_threads_oaa.txt", 500);
+  std::ifstream original(data_file);
+  std::ofstream multiclass(data_file + ".oaa");
+  std::string line;
+  for (size_t i = 0; std::getline(original, line); ++i)
+  {
+    multiclass << (1 + i % 3) << line.substr(line.find(' ')) << '\n';
+  }
+  multiclass.close();
+
+  auto serial = train_with_driver({"--quiet", "-d", data_file + ".oaa", "--oaa", "3"});
+  auto fallback = train_with_driver({"--quiet", "-d", data_file + ".oaa", "--oaa", "3", "--learner_threads", "2"});
+
+  // The fallback is the deterministic single threaded driver.
+  EXPECT_EQ(fallback->sd->example_number, serial->sd->example_number);
+  EXPECT_DOUBLE_EQ(fallback->sd->sum_loss, serial->sd->sum_loss);
+
+  serial->finish();
+  fallback->finish();
+  std::remove(data_file.c_str());
+  std::remove((data_file + ".oaa").c_str());
+}
+
+TEST(Learner, LearnerThreadsMustBePositive)
+{
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--learner_threads", "0")), VW::vw_exception);
+}
+
+TEST(Learner, StackIsFusedByDefault)
+{
+  auto fused = VW::initialize(vwtest::make_args("--quiet", "--oaa", "3"));
+  auto dynamic = VW::initialize(vwtest::make_args("--quiet", "--oaa", "3", "--dynamic_reduction_stack"));
+
+  for (auto* l = fused->l.get(); l != nullptr; l = l->get_base_learner()) { EXPECT_TRUE(l->is_fused()); }
+  for (auto* l = dynamic->l.get(); l != nullptr; l = l->get_base_learner()) { EXPECT_FALSE(l->is_fused()); }
+}
+
+TEST(Learner, FusedStackMatchesDynamicStack)
+{
+  const std::vector<std::vector<std::string>> stacks = {
+      {"--binary", "--link", "logistic"}, {"--oaa", "3"}, {"--csoaa", "3"}, {"--cb_explore_adf", "--epsilon", "0.1"}};
+  for (const auto& stack : stacks)
+  {
+    std::vector<std::unique_ptr<VW::workspace>> workspaces;
+    for (bool dynamic : {false, true})
+    {
+      auto args = stack;
+      args.insert(args.end(), {"--quiet", "--random_seed", "3", "-b", "12"});
+      if (dynamic) { args.push_back("--dynamic_reduction_stack"); }
+      auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+      for (size_t i = 0; i < 50; i++)
+      {
+        const std::string features = " | x" + std::to_string(i % 7) + " y:" + std::to_string(i % 5);
+        if (vw->l->is_multiline())
+        {
+          VW::multi_ex examples;
+          examples.push_back(VW::read_example(*vw, "shared" + features));
+          for (size_t a = 0; a < 3; a++)
+          {
+            const std::string label = a == i % 3 ? "0:" + std::to_string(a) + ":0.5" : "";
+            examples.push_back(VW::read_example(*vw, label + " | a" + std::to_string(a)));
+          }
+          vw->learn(examples);
+          vw->finish_example(examples);
+        }
+        else
+        {
+          std::string label = std::to_string(1 + i % 3);
+          if (stack[0] == "--binary") { label = i % 2 == 0 ? "1" : "-1"; }
+          else if (stack[0] == "--csoaa") { label += ":0.5 2:1"; }
+          auto* ex = VW::read_example(*vw, label + features);
+          vw->learn(*ex);
+          vw->finish_example(*ex);
+        }
+      }
+      workspaces.push_back(std::move(vw));
+    }
+
+    auto& fused = *workspaces[0];
+    auto& dynamic = *workspaces[1];
+    EXPECT_DOUBLE_EQ(fused.sd->sum_loss, dynamic.sd->sum_loss) << stack[0];
+    for (uint64_t i = 0; i < (fused.length() << fused.weights.stride_shift()); i++)
+    {
+      ASSERT_EQ(fused.weights[i], dynamic.weights[i]) << stack[0] << " weight " << i;
+    }
+  }
+}
+
 // Note: Edge case tests were removed as they duplicated tests above:
 // - LearnerIsMultiline duplicated IsMultilineReturnsFalse/TrueForSingleline/MultilineLearner
 // - LearnerPredictionType duplicated GetOutputPredictionType tests
@@ -2,15 +2,22 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
 #include "vw/core/parse_args.h"
 #include "vw/core/parse_example.h"
 #include "vw/core/parse_primitives.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
 TEST(Parser, DecodeInlineHexTest)
 {
   auto nl = VW::io::create_null_logger();
@@ -58,4 +65,124 @@ TEST(Parser, TrimWhitespaceTest)
   EXPECT_TRUE("a\nb     c" == VW::trim_whitespace(std::string("              a\nb     c               ")));
   EXPECT_TRUE("a\nb     \tc" == VW::trim_whitespace(std::string("     \t         a\nb     \tc        \t\t       ")));
   EXPECT_TRUE("" == VW::trim_whitespace(std::string("     \t                 \t\t       ")));
-}
\ No newline at end of file
+}
+
+namespace
+{
+std::string write_parse_threads_data_file(const std::string& name, size_t num_lines)
+{
+  const auto file_name = ::testing::TempDir() + name;
+  std::ofstream data(file_name);
+  for (size_t i = 0; i < num_lines; ++i)
+  {
+    data << (i % 3 == 0 ? "1" : "-1") << " " << (1 + i % 4) << " 'tag" << i << " |a x" << i % 17 << ":" << 0.5f * (i % 5)
+         << " y" << i % 7 << " |b z" << i % 11 << " w" << i << '\n';
+    // Empty lines and lines without features are handled the same way by every parse thread.
+    if (i % 50 == 0) { data << '\n'; }
+  }
+  return file_name;
+}
+
+std::shared_ptr<VW::shared_data> run_driver(const std::vector<std::string>& args)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+  if (vw->parser_runtime.example_parser->exc_ptr) { std::rethrow_exception(vw->parser_runtime.example_parser->exc_ptr); }
+  auto sd = vw->sd;
+  vw->finish();
+  return sd;
+}
+}  // namespace
+
+TEST(Parser, ParseThreadsMatchesSingleThreadedParse)
+{
+  const auto data_file = write_parse_threads_data_file("vw_parse_threads.txt", 2000);
+  const std::vector<std::string> base_args = {"--quiet", "-d", data_file, "-q", "ab", "--example_queue_limit", "16"};
+
+  auto expected = run_driver(base_args);
+  for (const auto* threads : {"2", "4"})
+  {
+    auto args = base_args;
+    args.insert(args.end(), {"--parse_threads", threads});
+    auto actual = run_driver(args);
+    EXPECT_EQ(actual->example_number, expected->example_number);
+    EXPECT_EQ(actual->total_features, expected->total_features);
+    EXPECT_DOUBLE_EQ(actual->sum_loss, expected->sum_loss);
+    EXPECT_DOUBLE_EQ(actual->weighted_labels, expected->weighted_labels);
+  }
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, ParseThreadsMultiplePassesAndExampleLimit)
+{
+  const auto data_file = write_parse_threads_data_file("vw_parse_threads_passes.txt", 500);
+  const auto cache_file = data_file + ".cache";
+  const std::vector<std::string> base_args = {
+      "--quiet", "-d", data_file, "-k", "--cache_file", cache_file, "--passes", "3", "--holdout_off"};
+
+  auto expected = run_driver(base_args);
+  auto args = base_args;
+  args.insert(args.end(), {"--parse_threads", "3"});
+  auto actual = run_driver(args);
+  EXPECT_EQ(actual->example_number, expected->example_number);
+  EXPECT_DOUBLE_EQ(actual->sum_loss, expected->sum_loss);
+
+  // Stopping early leaves lines that were read ahead in flight, they must be returned without being learned from.
+  auto limited_expected = run_driver({"--quiet", "-d", data_file, "--examples", "100"});
+  auto limited = run_driver({"--quiet", "-d", data_file, "--examples", "100", "--parse_threads", "4"});
+  EXPECT_EQ(limited->example_number, limited_expected->example_number);
+  EXPECT_DOUBLE_EQ(limited->sum_loss, limited_expected->sum_loss);
+  std::remove(cache_file.c_str());
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, ParseThreadsDecodesCacheFiles)
+{
+  const auto data_file = write_parse_threads_data_file("vw_parse_threads_cache.txt", 1000);
+  const auto cache_file = data_file + ".cache";
+  // The first run writes the cache, the others only read it.
+  auto expected = run_driver({"--quiet", "-d", data_file, "--cache_file", cache_file, "-q", "ab"});
+  const std::vector<std::string> base_args = {"--quiet", "--cache_file", cache_file, "-q", "ab", "--passes", "2",
+      "--holdout_off"};
+  auto serial = run_driver(base_args);
+  for (const auto* threads : {"2", "4"})
+  {
+    auto args = base_args;
+    args.insert(args.end(), {"--parse_threads", threads});
+    auto actual = run_driver(args);
+    EXPECT_EQ(actual->example_number, 2 * expected->example_number);
+    EXPECT_EQ(actual->example_number, serial->example_number);
+    EXPECT_EQ(actual->total_features, serial->total_features);
+    EXPECT_DOUBLE_EQ(actual->sum_loss, serial->sum_loss);
+    EXPECT_DOUBLE_EQ(actual->weighted_labels, serial->weighted_labels);
+  }
+
+  // A truncated cache fails in the same way as with a single parse thread.
+  std::string contents;
+  {
+    std::ifstream in(cache_file, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(cache_file, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size() - 5));
+  }
+  EXPECT_THROW(run_driver({"--quiet", "--cache_file", cache_file}), VW::vw_exception);
+  EXPECT_THROW(run_driver({"--quiet", "--cache_file", cache_file, "--parse_threads", "4"}), VW::vw_exception);
+  std::remove(cache_file.c_str());
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, ParseThreadsSurfacesStrictParseErrors)
+{
+  const auto file_name = ::testing::TempDir() + "vw_parse_threads_strict.txt";
+  {
+    std::ofstream data(file_name);
+    for (size_t i = 0; i < 100; ++i) { data << "1 |a x" << i << '\n'; }
+    data << "1 |a x:nan\n";
+  }
+  EXPECT_THROW(run_driver({"--quiet", "-d", file_name, "--strict_parse", "--parse_threads", "4"}), VW::vw_exception);
+  std::remove(file_name.c_str());
+}
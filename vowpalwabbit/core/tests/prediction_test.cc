@@ -2,12 +2,54 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/config/options_cli.h"
+#include "vw/core/memory.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
+namespace
+{
+void expect_batch_matches_predict(const std::vector<std::string>& args)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  const std::vector<std::string> train = {"1 |a x y z |b u", "-1 |a x |b v w", "0.5 |a y:2 |b u w", "-0.5 |b z"};
+  for (size_t pass = 0; pass < 3; ++pass)
+  {
+    for (const auto& text : train)
+    {
+      auto* ex = VW::read_example(*vw, text);
+      vw->learn(*ex);
+      vw->finish_example(*ex);
+    }
+  }
+
+  const std::vector<std::string> test = {"|a x y z |b u", "1 |a x", "|b v w", "|a q r s t |b u v w", "", "|a y:2"};
+  VW::multi_ex batch;
+  std::vector<float> expected;
+  for (const auto& text : test)
+  {
+    auto* ex = VW::read_example(*vw, text);
+    vw->predict(*ex);
+    expected.push_back(ex->pred.scalar);
+    batch.push_back(ex);
+  }
+
+  VW::predict_batch(*vw, batch);
+  for (size_t i = 0; i < batch.size(); ++i)
+  {
+    EXPECT_FLOAT_EQ(batch[i]->pred.scalar, expected[i]) << test[i];
+    EXPECT_EQ(batch[i]->ft_offset, 0);
+    vw->finish_example(*batch[i]);
+  }
+}
+}  // namespace
+
 // Test case validating this issue: https://github.com/VowpalWabbit/vowpal_wabbit/issues/2166
 TEST(Predict, PredictModifyingState)
 {
@@ -43,3 +85,17 @@ TEST(Predict, PredictModifyingState)
 
   EXPECT_FLOAT_EQ(prediction_one, prediction_two);
 }
+
+TEST(Predict, PredictBatchMatchesPredict)
+{
+  expect_batch_matches_predict({"--quiet"});
+  expect_batch_matches_predict({"--quiet", "--link", "logistic", "-q", "ab"});
+  expect_batch_matches_predict({"--quiet", "--l1", "0.001"});
+  expect_batch_matches_predict({"--quiet", "--sparse_weights"});
+}
+
+TEST(Predict, PredictBatchFallsBackForReductionsWithoutBatching)
+{
+  expect_batch_matches_predict({"--quiet", "--nn", "2"});
+  expect_batch_matches_predict({"--quiet", "--bootstrap", "2"});
+}
@@ -11,7 +11,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <sstream>
 
 using namespace ::testing;
 
@@ -85,3 +90,143 @@ TEST(SaveLoad, SaveResumeBehavesAsIfDatasetConcatenated)
   EXPECT_EQ(vw_all_data_single_run->sd->weighted_examples(), vw_second_half_from_loaded->sd->weighted_examples());
   EXPECT_EQ(vw_all_data_single_run->sd->sum_loss, vw_second_half_from_loaded->sd->sum_loss);
 }
+
+namespace
+{
+std::unique_ptr<VW::workspace> train_dense_layout_model(const std::vector<std::string>& extra_args)
+{
+  std::vector<std::string> args = {"--quiet", "--no_stdin", "--dense_model_layout"};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  for (size_t i = 0; i < 200; i++)
+  {
+    auto* ex = VW::read_example(
+        *vw, std::to_string(i % 3) + " |f a" + std::to_string(i % 7) + " b:" + std::to_string(i % 5));
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  return vw;
+}
+
+float predict_dense_layout(VW::workspace& vw, const std::string& line)
+{
+  auto* ex = VW::read_example(vw, line);
+  vw.predict(*ex);
+  const float prediction = ex->pred.scalar;
+  vw.finish_example(*ex);
+  return prediction;
+}
+
+#ifdef __linux__
+// Returns true if address lies in a memory mapping of a file whose path ends with file_name.
+bool is_mapped_from_file(const void* address, const std::string& file_name)
+{
+  const auto target = reinterpret_cast<uintptr_t>(address);
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  while (std::getline(maps, line))
+  {
+    std::istringstream fields(line);
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    char dash = 0;
+    std::string permissions, offset, device, inode, path;
+    fields >> std::hex >> start >> dash >> end >> permissions >> offset >> device >> inode >> path;
+    if (start <= target && target < end)
+    {
+      return path.size() >= file_name.size() &&
+          path.compare(path.size() - file_name.size(), file_name.size(), file_name) == 0;
+    }
+  }
+  return false;
+}
+#endif
+}  // namespace
+
+TEST(SaveLoad, DenseModelLayoutRoundTripsThroughBuffer)
+{
+  auto vw = train_dense_layout_model({});
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*vw, io_writer);
+  io_writer.flush();
+
+  // Buffers cannot be mapped so the block is read instead.
+  auto loaded = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "--mmap_model"),
+      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  EXPECT_FLOAT_EQ(predict_dense_layout(*loaded, "|f a3 b:2"), predict_dense_layout(*vw, "|f a3 b:2"));
+  EXPECT_EQ(0, std::memcmp(loaded->weights.dense_weights.data(), vw->weights.dense_weights.data(),
+                   vw->weights.dense_weights.raw_length() * sizeof(VW::weight)));
+}
+
+TEST(SaveLoad, DenseModelLayoutMemoryMapsInitialRegressor)
+{
+  const auto model_file = ::testing::TempDir() + "vw_dense_model_layout.model";
+  {
+    auto vw = train_dense_layout_model({"-f", model_file, "-b", "16"});
+    vw->finish();
+  }
+
+  auto reference = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-i", model_file));
+  auto mapped = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-i", model_file, "--mmap_model"));
+#ifdef __linux__
+  // --mmap_model falls back to reading the weights with only a warning.
+  EXPECT_TRUE(is_mapped_from_file(mapped->weights.dense_weights.data(), "vw_dense_model_layout.model"));
+  EXPECT_FALSE(is_mapped_from_file(reference->weights.dense_weights.data(), "vw_dense_model_layout.model"));
+#endif
+  EXPECT_FLOAT_EQ(predict_dense_layout(*mapped, "|f a3 b:2"), predict_dense_layout(*reference, "|f a3 b:2"));
+
+  // The weights are mapped copy on write, learning must not change the model file.
+  for (size_t i = 0; i < 20; i++)
+  {
+    auto* ex = VW::read_example(*mapped, "5 |f a3 b:2");
+    mapped->learn(*ex);
+    mapped->finish_example(*ex);
+  }
+  EXPECT_NE(predict_dense_layout(*mapped, "|f a3 b:2"), predict_dense_layout(*reference, "|f a3 b:2"));
+  auto reloaded = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-i", model_file, "--mmap_model"));
+  EXPECT_FLOAT_EQ(predict_dense_layout(*reloaded, "|f a3 b:2"), predict_dense_layout(*reference, "|f a3 b:2"));
+
+  mapped.reset();
+  reloaded.reset();
+  std::remove(model_file.c_str());
+}
+
+TEST(SaveLoad, DenseModelLayoutAlignsBlockOfEveryOutputFile)
+{
+  auto vw = train_dense_layout_model({});
+  auto expected = std::make_shared<std::vector<char>>();
+  VW::io_buf fresh_writer;
+  fresh_writer.add_file(VW::io::create_vector_writer(expected));
+  VW::save_predictor(*vw, fresh_writer);
+  fresh_writer.flush();
+
+  // The padding before the weight block depends on the offset in the file being written, not on what the io_buf wrote
+  // to earlier files.
+  auto other = std::make_shared<std::vector<char>>();
+  auto saved = std::make_shared<std::vector<char>>();
+  VW::io_buf reused_writer;
+  reused_writer.add_file(VW::io::create_vector_writer(other));
+  reused_writer.bin_write_fixed("abc", 3);
+  reused_writer.flush();
+  reused_writer.close_file();
+  reused_writer.add_file(VW::io::create_vector_writer(saved));
+  VW::save_predictor(*vw, reused_writer);
+  reused_writer.flush();
+  EXPECT_EQ(*saved, *expected);
+}
+
+TEST(SaveLoad, DenseModelLayoutPredictOnlyModel)
+{
+  auto vw = train_dense_layout_model({"--predict_only_model", "--sgd"});
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*vw, io_writer);
+  io_writer.flush();
+
+  auto loaded = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-t"),
+      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  EXPECT_FLOAT_EQ(predict_dense_layout(*loaded, "|f a1 b:4"), predict_dense_layout(*vw, "|f a1 b:4"));
+}
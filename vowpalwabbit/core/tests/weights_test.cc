@@ -4,10 +4,16 @@
 
 #include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_sparse.h"
+#include "vw/core/memory.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 constexpr auto LENGTH = 16;
 constexpr auto STRIDE_SHIFT = 2;
 
@@ -47,4 +53,124 @@ TEST(DenseParametersTest, UninitializedIteratorIsEmptyRange)
   count = 0;
   for (auto it = params.cbegin(); it != params.cend(); ++it) { count++; }
   EXPECT_EQ(count, 0);
-}
\ No newline at end of file
+}
+TEST(SparseParametersTest, ReferencesStayValidWhileTableGrows)
+{
+  VW::sparse_parameters w(1 << 20, STRIDE_SHIFT);
+  VW::weight& first = w.strided_index(7);
+  first = 3.f;
+  (&first)[1] = 4.f;
+  for (size_t i = 0; i < 10000; i++) { w.strided_index(i) += 1.f; }
+
+  EXPECT_EQ(&w.strided_index(7), &first);
+  EXPECT_FLOAT_EQ(first, 4.f);
+  EXPECT_FLOAT_EQ((&first)[1], 4.f);
+  EXPECT_EQ(w.size(), 10000);
+
+  size_t count = 0;
+  for (auto it = w.begin(); it != w.end(); ++it)
+  {
+    EXPECT_EQ(it.index() % w.stride(), 0);
+    EXPECT_FLOAT_EQ(*it, it.index() == 7 * w.stride() ? 4.f : 1.f);
+    count++;
+  }
+  EXPECT_EQ(count, 10000);
+}
+
+TEST(SparseParametersTest, ConstLookupDoesNotInsert)
+{
+  VW::sparse_parameters w(LENGTH, STRIDE_SHIFT);
+  w.set_default([](VW::weight* weights, uint64_t index) { weights[0] = 1.f * index; });
+  const auto& const_w = w;
+
+  EXPECT_FLOAT_EQ(const_w[3 * w.stride()], 3.f * w.stride());
+  EXPECT_FLOAT_EQ(const_w.get(5 * w.stride()), 5.f * w.stride());
+  EXPECT_EQ(w.size(), 0);
+  EXPECT_EQ(w.begin(), w.end());
+}
+
+TEST(SparseParametersTest, ShallowCopySharesExistingWeightsOnly)
+{
+  VW::sparse_parameters w(LENGTH, STRIDE_SHIFT);
+  w.strided_index(1) = 1.f;
+
+  VW::sparse_parameters copy;
+  copy.shallow_copy(w);
+  copy.strided_index(1) = 2.f;
+  copy.strided_index(2) = 3.f;
+
+  EXPECT_FLOAT_EQ(w.strided_index(1), 2.f);
+  EXPECT_EQ(w.size(), 1);
+  EXPECT_EQ(copy.size(), 2);
+  w.strided_index(3) = 4.f;
+  EXPECT_NE(&w.strided_index(3), &copy.strided_index(3));
+}
+
+TEST(SparseParametersTest, ConcurrentInsertsShareOneTable)
+{
+  VW::sparse_parameters w(1 << 16, STRIDE_SHIFT);
+  w.strided_index(0) = 1.f;
+  w.enable_concurrent_inserts(8);
+  EXPECT_FLOAT_EQ(w.strided_index(0), 1.f);
+
+  constexpr size_t NUM_THREADS = 4;
+  constexpr size_t NUM_INDICES = 5000;
+  std::vector<std::unique_ptr<VW::sparse_parameters>> replicas;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < NUM_THREADS; t++)
+  {
+    replicas.push_back(VW::make_unique<VW::sparse_parameters>());
+    replicas.back()->shallow_copy(w);
+    auto* replica = replicas.back().get();
+    // Every thread inserts the same indices, each of them takes its own stride slot.
+    threads.emplace_back([replica, t] {
+      for (size_t i = 1; i <= NUM_INDICES; i++) { (&replica->strided_index(i))[t] = 1.f; }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  EXPECT_EQ(w.size(), NUM_INDICES + 1);
+  for (size_t i = 1; i <= NUM_INDICES; i++)
+  {
+    for (size_t t = 0; t < NUM_THREADS; t++) { EXPECT_FLOAT_EQ((&w.strided_index(i))[t], 1.f); }
+  }
+  EXPECT_THROW(w.enable_concurrent_inserts(3), VW::vw_exception);
+}
+
+TEST(SparseParametersTest, ModelsAreCopiedSwappedAndReleased)
+{
+  constexpr size_t MODELS = 4;
+  VW::sparse_parameters w(1 << 10, STRIDE_SHIFT);
+  w.set_model_width(MODELS);
+  auto index = [](size_t feature, size_t model) { return feature * MODELS + model; };
+  for (size_t feature = 0; feature < 100; feature++)
+  {
+    w.strided_index(index(feature, 1)) = 1.f + feature;
+    (&w.strided_index(index(feature, 1)))[1] = 2.f;
+    if (feature % 2 == 0) { w.strided_index(index(feature, 2)) = -1.f; }
+  }
+  EXPECT_EQ(w.size(), 150);
+
+  w.copy_model(1, 3);
+  w.swap_models(1, 2);
+  for (size_t feature = 0; feature < 100; feature++)
+  {
+    EXPECT_FLOAT_EQ(w.strided_index(index(feature, 3)), 1.f + feature);
+    EXPECT_FLOAT_EQ((&w.strided_index(index(feature, 3)))[1], 2.f);
+    EXPECT_FLOAT_EQ(w.strided_index(index(feature, 2)), 1.f + feature);
+  }
+  EXPECT_EQ(w.size(), 250);
+
+  w.release_model(2);
+  w.release_model(3);
+  EXPECT_EQ(w.size(), 50);
+  for (auto it = w.begin(); it != w.end(); ++it)
+  {
+    EXPECT_EQ(it.index() % (MODELS * w.stride()), 1 * w.stride());
+    EXPECT_FLOAT_EQ(*it, -1.f);
+  }
+
+  EXPECT_THROW(w.copy_model(0, MODELS), VW::vw_exception);
+  EXPECT_THROW(w.set_model_width(8), VW::vw_exception);
+  EXPECT_THROW(w.set_model_width(3), VW::vw_exception);
+}
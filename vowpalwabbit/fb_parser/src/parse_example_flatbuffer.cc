@@ -521,11 +521,17 @@ int parser::parse_namespaces(VW::workspace* all, example* ae, const Namespace* n
       RETURN_NS_PARSER_ERROR(status, fb_parser_size_mismatch_ft_hashes_ft_values)
     }
 
+#if FLATBUFFERS_LITTLEENDIAN
+    // The flatbuffer vectors are laid out like features::values and features::indices, so they are copied straight out
+    // of the input buffer instead of feature by feature.
+    fs.append(ns->feature_values()->data(), ns->feature_hashes()->data(), ns->feature_values()->size());
+#else
     auto feature_hash_iter = (ns->feature_hashes())->begin();
     for (; feature_value_iter != feature_value_iter_end; ++feature_value_iter, ++feature_hash_iter)
     {
       fs.push_back(*feature_value_iter, *feature_hash_iter);
     }
+#endif
   }
 
   // Cancel the guard — we'll call end_ns_extent ourselves on the success path.
@@ -195,6 +195,43 @@ TEST(FlatbufferParser, SingleExample_SimpleLabel_FeatureHashes)
   VW::finish_example(*all, *examples[0]);
 }
 
+TEST(FlatbufferParser, SingleExample_FeatureHashesOfSharedNamespaceIndex)
+{
+  auto all = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--flatbuffer"));
+
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<VW::parsers::flatbuffer::Namespace>> namespaces;
+  const std::vector<float> first_values = {1.f, 2.f, 3.f};
+  const std::vector<uint64_t> first_hashes = {11, 12, 13};
+  const std::vector<float> second_values = {0.5f};
+  const std::vector<uint64_t> second_hashes = {21};
+  namespaces.push_back(VW::parsers::flatbuffer::CreateNamespaceDirect(
+      builder, nullptr, 'a', 100, nullptr, &first_values, &first_hashes));
+  namespaces.push_back(VW::parsers::flatbuffer::CreateNamespaceDirect(
+      builder, nullptr, 'a', 200, nullptr, &second_values, &second_hashes));
+  auto label = get_label(builder, VW::parsers::flatbuffer::Label_SimpleLabel);
+  auto example = VW::parsers::flatbuffer::CreateExampleDirect(
+      builder, &namespaces, VW::parsers::flatbuffer::Label_SimpleLabel, label);
+  builder.FinishSizePrefixed(CreateExampleRoot(builder, VW::parsers::flatbuffer::ExampleType_Example, example.Union()));
+
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(all.get()));
+  VW::io_buf unused_buffer;
+  all->parser_runtime.flat_converter->parse_examples(all.get(), unused_buffer, examples, builder.GetBufferPointer());
+
+  // Both namespaces land in the same feature group, each in its own extent.
+  ASSERT_EQ(examples[0]->indices.size(), 1);
+  const auto& fs = examples[0]->feature_space['a'];
+  EXPECT_THAT(fs.values, testing::ElementsAre(1.f, 2.f, 3.f, 0.5f));
+  EXPECT_THAT(fs.indices, testing::ElementsAre(11, 12, 13, 21));
+  EXPECT_FLOAT_EQ(fs.sum_feat_sq, 14.25f);
+  ASSERT_EQ(fs.namespace_extents.size(), 2);
+  EXPECT_EQ(fs.namespace_extents[0], (VW::namespace_extent{0, 3, 100}));
+  EXPECT_EQ(fs.namespace_extents[1], (VW::namespace_extent{3, 4, 200}));
+
+  VW::finish_example(*all, *examples[0]);
+}
+
 TEST(FlatbufferParser, ExampleCollection_Singleline)
 {
   auto all = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--flatbuffer"));
@@ -54,6 +54,15 @@ public:
   /// \returns true if this reader can be reset, otherwise false
   bool is_resettable() const { return _is_resettable; }
 
+  /// Maps a region of the underlying file into memory with copy on write semantics and moves the read position to the
+  /// end of that region. Writes to the mapping are private to this process and never reach the file.
+  /// \param rewind_bytes the region starts this many bytes before the current read position, which allows callers
+  /// that buffer ahead to map from their logical position
+  /// \param num_bytes size of the region
+  /// \returns the mapped region, which stays valid while the returned pointer is alive, or nullptr if this reader
+  /// does not support mapping. Nothing is consumed when nullptr is returned.
+  virtual std::shared_ptr<char> map_copy_on_write(size_t rewind_bytes, size_t num_bytes);
+
   reader(reader& other) = delete;
   reader& operator=(reader& other) = delete;
   reader(reader&& other) = delete;
@@ -14,6 +14,7 @@
 #  include <io.h>
 #  include <winsock2.h>
 #else
+#  include <sys/mman.h>
 #  include <sys/socket.h>
 #  include <unistd.h>
 #endif
@@ -149,6 +150,7 @@ public:
   ssize_t read(char* buffer, size_t num_bytes) override;
   ssize_t write(const char* buffer, size_t num_bytes) override;
   void reset() override;
+  std::shared_ptr<char> map_copy_on_write(size_t rewind_bytes, size_t num_bytes) override;
 
 private:
   int _file_descriptor;
@@ -245,6 +247,7 @@ namespace io
 {
 
 void reader::reset() { THROW("Reset not supported for this io_adapter"); }
+std::shared_ptr<char> reader::map_copy_on_write(size_t /*rewind_bytes*/, size_t /*num_bytes*/) { return nullptr; }
 std::unique_ptr<writer> open_file_writer(const std::string& file_path)
 {
   return std::unique_ptr<writer>(new file_adapter(file_path.c_str(), file_mode::WRITE));
@@ -406,6 +409,37 @@ void file_adapter::reset()
 #endif
 }
 
+std::shared_ptr<char> file_adapter::map_copy_on_write(size_t rewind_bytes, size_t num_bytes)
+{
+#ifdef _WIN32
+  return reader::map_copy_on_write(rewind_bytes, num_bytes);
+#else
+  if (_mode != file_mode::READ || num_bytes == 0) { return nullptr; }
+
+  const off_t position = ::lseek(_file_descriptor, 0, SEEK_CUR);
+  struct stat file_stat;
+  if (position < 0 || static_cast<size_t>(position) < rewind_bytes || ::fstat(_file_descriptor, &file_stat) != 0)
+  {
+    return nullptr;
+  }
+  const auto start = static_cast<size_t>(position) - rewind_bytes;
+  // Touching a mapped page past the end of the file raises SIGBUS, so the whole region has to exist.
+  if (!S_ISREG(file_stat.st_mode) || start + num_bytes > static_cast<size_t>(file_stat.st_size)) { return nullptr; }
+
+  // The mapping offset has to be a multiple of the page size.
+  const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  const size_t page_offset = start % page_size;
+  const size_t mapped_length = num_bytes + page_offset;
+  void* mapped = ::mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, MAP_PRIVATE, _file_descriptor,
+      static_cast<off_t>(start - page_offset));
+  if (mapped == MAP_FAILED) { return nullptr; }
+
+  ::lseek(_file_descriptor, static_cast<off_t>(start + num_bytes), SEEK_SET);
+  return std::shared_ptr<char>(
+      static_cast<char*>(mapped) + page_offset, [mapped, mapped_length](char*) { ::munmap(mapped, mapped_length); });
+#endif
+}
+
 file_adapter::~file_adapter()
 {
   if (_should_close)
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstdio>
 #include <cstring>
 #include <memory>
 
@@ -59,3 +60,44 @@ TEST(IoAdapter, IoAdapterBufferView)
     EXPECT_EQ(std::strncmp(read_buffer3, "test another", 13), 0);
   }
 }
+
+TEST(IoAdapter, IoAdapterFileMapCopyOnWrite)
+{
+  const auto file_name = ::testing::TempDir() + "vw_io_adapter_map.bin";
+  {
+    auto writer = VW::io::open_file_writer(file_name);
+    EXPECT_EQ(writer->write("headerpayload tail", 18), 18);
+  }
+
+  auto reader = VW::io::open_file_reader(file_name);
+  char read_buffer[8];
+  EXPECT_EQ(reader->read(read_buffer, 8), 8);
+
+  // Map "payload" which starts 2 bytes before the current read position.
+  auto mapped = reader->map_copy_on_write(2, 7);
+#ifdef _WIN32
+  EXPECT_EQ(mapped, nullptr);
+#else
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_EQ(std::strncmp(mapped.get(), "payload", 7), 0);
+  // Writes are private to the mapping.
+  mapped.get()[0] = 'P';
+
+  char rest[5];
+  EXPECT_EQ(reader->read(rest, 5), 5);
+  EXPECT_EQ(std::strncmp(rest, " tail", 5), 0);
+
+  // Regions past the end of the file cannot be mapped.
+  EXPECT_EQ(reader->map_copy_on_write(0, 1), nullptr);
+
+  reader->reset();
+  char all[18];
+  EXPECT_EQ(reader->read(all, 18), 18);
+  EXPECT_EQ(std::strncmp(all, "headerpayload tail", 18), 0);
+#endif
+
+  EXPECT_EQ(VW::io::create_buffer_view(read_buffer, 8)->map_copy_on_write(0, 8), nullptr);
+  mapped.reset();
+  reader.reset();
+  std::remove(file_name.c_str());
+}
@@ -8,6 +8,7 @@
 #include "vw/core/vw_fwd.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace VW
 {
@@ -18,6 +19,10 @@ namespace text
 namespace details
 {
 void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example);
+// Same as above but uses caller owned scratch space instead of the parser's, so it can be called from several threads
+// concurrently as long as each thread passes its own words and reuse_mem.
+void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem);
 size_t read_features(io_buf& buf, char*& line, size_t& num_chars);
 }  // namespace details
 
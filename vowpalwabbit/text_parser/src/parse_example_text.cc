@@ -18,9 +18,72 @@
 
 #include <cctype>
 #include <cmath>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#endif
 
 namespace
 {
+inline bool is_name_end(char c) { return c == ' ' || c == ':' || c == '\t' || c == '|' || c == '\r'; }
+
+inline uint32_t count_trailing_zeros(uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<uint32_t>(index);
+#else
+  return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+// Returns the position of the first character at or after idx that ends a feature or namespace name, or the size of
+// the line. Names are compared a vector at a time against all five delimiters, the rest of the line byte by byte.
+inline FORCE_INLINE size_t find_name_end(VW::string_view line, size_t idx)
+{
+  const char* data = line.data();
+  const size_t size = line.size();
+#if defined(__AVX2__)
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i colon = _mm256_set1_epi8(':');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i bar = _mm256_set1_epi8('|');
+  const __m256i carriage_return = _mm256_set1_epi8('\r');
+  for (; idx + 32 <= size; idx += 32)
+  {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + idx));
+    const __m256i hits = _mm256_or_si256(
+        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, colon)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, tab), _mm256_cmpeq_epi8(chunk, bar))),
+        _mm256_cmpeq_epi8(chunk, carriage_return));
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+    if (mask != 0) { return idx + count_trailing_zeros(mask); }
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i colon = _mm_set1_epi8(':');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i bar = _mm_set1_epi8('|');
+  const __m128i carriage_return = _mm_set1_epi8('\r');
+  for (; idx + 16 <= size; idx += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + idx));
+    const __m128i hits =
+        _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, colon)),
+                         _mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, bar))),
+            _mm_cmpeq_epi8(chunk, carriage_return));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+    if (mask != 0) { return idx + count_trailing_zeros(mask); }
+  }
+#endif
+  while (idx < size && !is_name_end(data[idx])) { ++idx; }
+  return idx;
+}
+
 template <bool audit>
 class tc_parser
 {
@@ -123,12 +186,7 @@ private:
   inline FORCE_INLINE VW::string_view read_name()
   {
     size_t name_start = _read_idx;
-    while (!(_read_idx >= _line.size() || _line[_read_idx] == ' ' || _line[_read_idx] == ':' ||
-        _line[_read_idx] == '\t' || _line[_read_idx] == '|' || _line[_read_idx] == '\r'))
-    {
-      ++_read_idx;
-    }
-
+    _read_idx = find_name_end(_line, _read_idx);
     return _line.substr(name_start, _read_idx - name_start);
   }
 
@@ -454,6 +512,13 @@ public:
 };
 }  // namespace
 void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example)
+{
+  substring_to_example(all, ae, example, all->parser_runtime.example_parser->words,
+      all->parser_runtime.example_parser->parser_memory_to_reuse);
+}
+
+void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem)
 {
   if (example.empty()) { ae->is_newline = true; }
 
@@ -461,7 +526,7 @@ void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::ex
 
   size_t bar_idx = example.find('|');
 
-  all->parser_runtime.example_parser->words.clear();
+  words.clear();
   if (bar_idx != 0)
   {
     VW::string_view label_space(example);
@@ -474,25 +539,22 @@ void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::ex
     size_t tab_idx = label_space.find('\t');
     if (tab_idx != VW::string_view::npos) { label_space.remove_prefix(tab_idx + 1); }
 
-    VW::tokenize(' ', label_space, all->parser_runtime.example_parser->words);
-    if (all->parser_runtime.example_parser->words.size() > 0 &&
-        ((all->parser_runtime.example_parser->words.back().data() +
-             all->parser_runtime.example_parser->words.back().size()) == (label_space.data() + label_space.size()) ||
-            all->parser_runtime.example_parser->words.back().front() ==
-                '\''))  // The last field is a tag, so record and strip it off
+    VW::tokenize(' ', label_space, words);
+    if (words.size() > 0 &&
+        ((words.back().data() + words.back().size()) == (label_space.data() + label_space.size()) ||
+            words.back().front() == '\''))  // The last field is a tag, so record and strip it off
     {
-      VW::string_view tag = all->parser_runtime.example_parser->words.back();
-      all->parser_runtime.example_parser->words.pop_back();
+      VW::string_view tag = words.back();
+      words.pop_back();
       if (tag.front() == '\'') { tag.remove_prefix(1); }
       ae->tag.insert(ae->tag.end(), tag.begin(), tag.end());
     }
   }
 
-  if (!all->parser_runtime.example_parser->words.empty())
+  if (!words.empty())
   {
-    all->parser_runtime.example_parser->lbl_parser.parse_label(ae->l, ae->ex_reduction_features,
-        all->parser_runtime.example_parser->parser_memory_to_reuse, all->sd->ldict.get(),
-        all->parser_runtime.example_parser->words, all->logger);
+    all->parser_runtime.example_parser->lbl_parser.parse_label(
+        ae->l, ae->ex_reduction_features, reuse_mem, all->sd->ldict.get(), words, all->logger);
   }
 
   if (bar_idx != VW::string_view::npos)